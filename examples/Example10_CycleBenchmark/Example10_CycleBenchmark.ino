@@ -0,0 +1,144 @@
+/*
+  Control a SSD1320 based flexible OLED display
+  SparkFun Electronics
+  Date: October 18th, 2026
+  License: This code is public domain but you buy me a beer if you use this and we meet someday (Beerware license).
+
+  Counts the number of CPU cycles the main library functions take.
+  On AVR, Timer1 runs at the CPU clock with no prescaler and its overflows are counted.
+  The millis() interrupt is paused while measuring so it doesn't add to the count.
+  Other platforms fall back to micros() scaled by F_CPU.
+
+  Results are printed as CSV at 115200bps. The sketch is meant to also run under the simavr
+  simulator, but that has not been tried yet; see extras/avr/README.md.
+
+  To connect the display to an Arduino:
+  (Arduino pin) = (Display pin)
+  Pin 13 = SCLK on display carrier
+  11 = SDIN
+  10 = !CS
+  9 = !RES
+
+  The display is 160 pixels long and 32 pixels wide
+  Each 4-bit nibble is the 4-bit grayscale for that pixel
+  Therefore each byte of data written to the display paints two sequential pixels
+  Loops that write to the display should be 80 iterations wide and 32 iterations tall
+*/
+
+#include <SSD1320_OLED.h>
+
+SSD1320 flexibleOLED(10, 9); //10 = CS, 9 = RES
+
+#if defined(__AVR__)
+#include <avr/sleep.h>
+
+volatile uint16_t timerOverflows;
+
+ISR(TIMER1_OVF_vect)
+{
+  timerOverflows++;
+}
+
+uint8_t savedTimer0Mask;
+
+void startCycleCount()
+{
+  savedTimer0Mask = TIMSK0;
+  TIMSK0 = 0; //Pause the millis() interrupt
+
+  TCCR1A = 0;
+  TCCR1B = 0;
+  TCNT1 = 0;
+  timerOverflows = 0;
+  TIFR1 = _BV(TOV1);
+  TIMSK1 = _BV(TOIE1);
+  TCCR1B = _BV(CS10); //Count at the CPU clock
+}
+
+uint32_t stopCycleCount()
+{
+  TCCR1B = 0; //Stop the timer
+  uint16_t count = TCNT1;
+  if (TIFR1 & _BV(TOV1)) timerOverflows++; //Overflow that didn't get serviced
+  TIMSK1 = 0;
+  TIMSK0 = savedTimer0Mask;
+
+  return ((uint32_t)timerOverflows << 16) + count;
+}
+#else
+unsigned long startMicros;
+
+void startCycleCount()
+{
+  startMicros = micros();
+}
+
+uint32_t stopCycleCount()
+{
+  return (micros() - startMicros) * (F_CPU / 1000000UL);
+}
+#endif
+
+uint32_t overhead = 0;
+
+void report(const char *name, uint32_t cycles)
+{
+  cycles = (cycles > overhead) ? cycles - overhead : 0;
+  Serial.print(name);
+  Serial.print(",");
+  Serial.print(cycles);
+  Serial.print(",");
+  Serial.println(cycles / (F_CPU / 1000000UL));
+}
+
+#define MEASURE(name, code) { startCycleCount(); code; report(name, stopCycleCount()); }
+
+void setup()
+{
+  Serial.begin(115200);
+
+  flexibleOLED.begin(160, 32); //Display is 160 wide, 32 high
+
+  //The cost of starting and stopping the count
+  startCycleCount();
+  overhead = stopCycleCount();
+
+  Serial.print("F_CPU,");
+  Serial.println(F_CPU);
+  Serial.println("function,cycles,us");
+
+  MEASURE("begin", flexibleOLED.begin(160, 32));
+  MEASURE("clearDisplay(CLEAR_ALL)", flexibleOLED.clearDisplay(CLEAR_ALL));
+  MEASURE("clearDisplay(CLEAR_BUFFER)", flexibleOLED.clearDisplay(CLEAR_BUFFER));
+  MEASURE("setPixel", flexibleOLED.setPixel(80, 16));
+  MEASURE("line", flexibleOLED.line(0, 0, 159, 31));
+  MEASURE("rect", flexibleOLED.rect(10, 4, 60, 20));
+  MEASURE("rectFill", flexibleOLED.rectFill(80, 6, 40, 20));
+  MEASURE("circle", flexibleOLED.circle(40, 16, 12));
+  MEASURE("circleFill", flexibleOLED.circleFill(120, 16, 12));
+
+  flexibleOLED.setFontType(0);
+  MEASURE("drawChar(font0)", flexibleOLED.drawChar(3, 3, 'A'));
+  flexibleOLED.setFontType(1);
+  MEASURE("drawChar(font1)", flexibleOLED.drawChar(13, 3, 'A'));
+  flexibleOLED.setFontType(0);
+  flexibleOLED.setCursor(0, 24);
+  MEASURE("print(12 chars)", flexibleOLED.print("Hello World!"));
+
+  MEASURE("display", flexibleOLED.display());
+
+  Serial.println("done");
+
+#if defined(__AVR__)
+  //Halt. simavr quits when the CPU sleeps with interrupts off.
+  Serial.flush();
+  cli();
+  sleep_enable();
+  sleep_cpu();
+#endif
+}
+
+void loop()
+{
+
+}
@@ -0,0 +1,96 @@
+/*
+  Control a SSD1320 based flexible OLED display
+  SparkFun Electronics
+  License: This code is public domain but you buy me a beer if you use this and we meet someday (Beerware license).
+
+  Show frames per second and how much of each frame is spent pushing pixels over
+  the bus, on top of a bouncing ball.
+
+  Frame statistics are compiled out by default. Uncomment
+  #define SSD1320_ENABLE_STATS
+  near the top of SSD1320_OLED.h before building this example.
+
+  To connect the display to an Arduino:
+  (Arduino pin) = (Display pin)
+  Pin 13 = SCLK on display carrier
+  11 = SDIN
+  10 = !CS
+  9 = !RES
+*/
+
+#include <SSD1320_OLED.h>
+
+#ifndef SSD1320_ENABLE_STATS
+#error "Uncomment #define SSD1320_ENABLE_STATS in SSD1320_OLED.h to use frame statistics"
+#endif
+
+//Initialize the display with the follow pin connections
+SSD1320 flexibleOLED(10, 9); //10 = CS, 9 = RES
+
+unsigned long lastFrames = 0;
+unsigned long lastTime = 0;
+unsigned long lastDraw = 0;
+unsigned long lastFlush = 0;
+int fps = 0;
+int busPercent = 0;
+
+//Called at the end of every display(). Work out the numbers once a second.
+void frameDone(const SSD1320_Stats &stats)
+{
+  if (stats.flushEnd - lastTime < 1000000UL) return;
+
+  unsigned long frames = stats.framesFlushed - lastFrames;
+  unsigned long draw = stats.totalDrawMicros - lastDraw;
+  unsigned long flush = stats.totalFlushMicros - lastFlush;
+
+  fps = frames * 1000000UL / (stats.flushEnd - lastTime);
+  if (draw + flush > 0) busPercent = flush * 100UL / (draw + flush);
+
+  Serial.print(fps);
+  Serial.print(" fps, draw ");
+  Serial.print(stats.drawMicros);
+  Serial.print("us, flush ");
+  Serial.print(stats.flushMicros);
+  Serial.print("us, ");
+  Serial.print(stats.bytesSent);
+  Serial.println(" bytes sent");
+
+  lastFrames = stats.framesFlushed;
+  lastDraw = stats.totalDrawMicros;
+  lastFlush = stats.totalFlushMicros;
+  lastTime = stats.flushEnd;
+}
+
+void setup()
+{
+  Serial.begin(115200);
+
+  flexibleOLED.begin(160, 32); //Display is 160 wide, 32 high
+  flexibleOLED.setFrameCallback(frameDone);
+  lastTime = micros();
+}
+
+int ballX = 20;
+int ballY = 16;
+int velocityX = 2;
+int velocityY = 1;
+
+void loop()
+{
+  ballX += velocityX;
+  ballY += velocityY;
+  if (ballX <= 3 || ballX >= flexibleOLED.getDisplayWidth() - 4) velocityX = -velocityX;
+  if (ballY <= 3 || ballY >= flexibleOLED.getDisplayHeight() - 4) velocityY = -velocityY;
+
+  flexibleOLED.clearDisplay(CLEAR_BUFFER);
+  flexibleOLED.circleFill(ballX, ballY, 3);
+
+  //Overlay in the corner
+  flexibleOLED.setCursor(0, 0);
+  flexibleOLED.print(fps);
+  flexibleOLED.print("fps ");
+  flexibleOLED.print(busPercent);
+  flexibleOLED.print("% bus");
+
+  flexibleOLED.display();
+}
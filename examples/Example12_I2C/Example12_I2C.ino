@@ -0,0 +1,54 @@
+/*
+  Control a SSD1320 based flexible OLED display
+  SparkFun Electronics
+  License: This code is public domain but you buy me a beer if you use this and we meet someday (Beerware license).
+
+  Drive the display over I2C instead of SPI. The panel's interface select pins must be
+  strapped for I2C. Each frame goes out as 31 byte Wire transmissions, one control byte
+  plus as much GDRAM data as the Wire buffer holds.
+
+  I2C support is compiled out by default so SPI sketches don't carry Wire. Uncomment
+  #define SSD1320_ENABLE_I2C
+  near the top of SSD1320_OLED.h before building this example.
+
+  To connect the display to an Arduino:
+  (Arduino pin) = (Display pin)
+  SDA = SDA
+  SCL = SCL
+  9 = !RES
+*/
+
+#include <Wire.h>
+#include <SSD1320_OLED.h>
+
+#ifndef SSD1320_ENABLE_I2C
+#error "Uncomment #define SSD1320_ENABLE_I2C in SSD1320_OLED.h to drive the display over I2C"
+#endif
+
+//0x3C with SA0 low, 0x3D with SA0 high. 9 = RES
+SSD1320 flexibleOLED(Wire, 0x3C, 9);
+
+void setup()
+{
+  Serial.begin(115200);
+
+  flexibleOLED.setI2CClock(400000); //Try 1000000 on short wires
+  flexibleOLED.begin(160, 32); //Display is 160 wide, 32 high
+}
+
+void loop()
+{
+  for (int x = 0 ; x < flexibleOLED.getDisplayWidth() ; x += 4)
+  {
+    flexibleOLED.clearDisplay(CLEAR_BUFFER);
+    flexibleOLED.setCursor(0, 12);
+    flexibleOLED.print("Hello over I2C!");
+    flexibleOLED.lineV(x, 0, flexibleOLED.getDisplayHeight());
+
+    unsigned long start = micros();
+    flexibleOLED.display();
+    Serial.print("Frame took ");
+    Serial.print(micros() - start);
+    Serial.println("us");
+  }
+}
@@ -0,0 +1,61 @@
+/*
+  Control a SSD1320 based flexible OLED display
+  SparkFun Electronics
+  License: This code is public domain but you buy me a beer if you use this and we meet someday (Beerware license).
+
+  Find the fastest SPI clock your wiring handles. Each clock is announced on the display
+  and over serial, then the self test pattern is drawn at that clock: a bright border, a
+  16 step gray ramp on one half and a fine checkerboard on the other. Speckles, wrong gray
+  steps or a shifted picture mean the clock is too fast. Pick the fastest clean one, with
+  some margin, and pass it to setSPIClock() or begin().
+
+  The SPI hardware rounds each clock down to what the board can do. An 8MHz Pro Mini
+  tops out at 4MHz.
+
+  To connect the display to an Arduino:
+  (Arduino pin) = (Display pin)
+  Pin 13 = SCLK on display carrier
+  11 = SDIN
+  10 = !CS
+  9 = !RES
+*/
+
+#include <SSD1320_OLED.h>
+
+//Initialize the display with the follow pin connections
+SSD1320 flexibleOLED(10, 9); //10 = CS, 9 = RES
+
+const uint32_t clocks[] = {1000000, 2000000, 4000000, 8000000, 12000000, 16000000, 24000000};
+#define TOTALCLOCKS (sizeof(clocks) / sizeof(clocks[0]))
+
+void setup()
+{
+  Serial.begin(115200);
+
+  flexibleOLED.begin(160, 32, 1000000); //Start slow so the init sequence gets through
+}
+
+void loop()
+{
+  for (uint8_t x = 0 ; x < TOTALCLOCKS ; x++)
+  {
+    //Announce it at a safe clock
+    flexibleOLED.setSPIClock(1000000);
+    flexibleOLED.clearDisplay(CLEAR_BUFFER);
+    flexibleOLED.setCursor(0, 12);
+    flexibleOLED.print("SPI ");
+    flexibleOLED.print(clocks[x] / 1000000);
+    flexibleOLED.print("MHz");
+    flexibleOLED.display();
+
+    Serial.print("Self test at ");
+    Serial.print(clocks[x]);
+    Serial.println("Hz");
+    delay(1000);
+
+    //Only the data clock changes so the address window always arrives intact
+    flexibleOLED.setSPIClock(1000000, clocks[x]);
+    flexibleOLED.selfTest();
+    delay(3000);
+  }
+}
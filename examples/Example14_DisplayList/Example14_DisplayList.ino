@@ -0,0 +1,56 @@
+/*
+  Control a SSD1320 based flexible OLED display
+  SparkFun Electronics
+  License: This code is public domain but you buy me a beer if you use this and we meet someday (Beerware license).
+
+  Record each frame into a display list instead of drawing it straight away. The list
+  is a few dozen bytes; when it comes out the same as the last frame nothing is drawn
+  or sent to the display. Here the screen only changes once a second even though
+  loop() builds the frame continuously.
+
+  To connect the display to an Arduino:
+  (Arduino pin) = (Display pin)
+  Pin 13 = SCLK on display carrier
+  11 = SDIN
+  10 = !CS
+  9 = !RES
+*/
+
+#include <SSD1320_OLED.h>
+#include <SSD1320_DisplayList.h>
+
+//Initialize the display with the follow pin connections
+SSD1320 flexibleOLED(10, 9); //10 = CS, 9 = RES
+
+uint8_t listBuffer[64];
+SSD1320_DisplayList frame(listBuffer, sizeof(listBuffer));
+
+void setup()
+{
+  Serial.begin(115200);
+
+  flexibleOLED.begin(160, 32); //Display is 160 wide, 32 high
+}
+
+void loop()
+{
+  unsigned long seconds = millis() / 1000;
+
+  frame.reset();
+  frame.clearDisplay(CLEAR_BUFFER);
+  frame.setFontType(0);
+  frame.setCursor(4, 12);
+  frame.print("Uptime ");
+  frame.print(seconds);
+  frame.print("s");
+  frame.rect(0, 0, 160, 32);
+  frame.rectFill(4, 4, seconds % 150 + 1, 4);
+
+  if (frame.replayIfChanged(flexibleOLED))
+  {
+    flexibleOLED.display();
+    Serial.print("New frame, list is ");
+    Serial.print(frame.length());
+    Serial.println(" bytes");
+  }
+}
@@ -0,0 +1,44 @@
+/*
+  Control a SSD1320 based flexible OLED display
+  SparkFun Electronics
+  License: This code is public domain but you buy me a beer if you use this and we meet someday (Beerware license).
+
+  Let a computer draw on the display over the serial port. The computer sends frames
+  of display list commands (see SSD1320_Server.h for the framing) and gets an ACK or
+  NAK back for each one. A whole screen of text and shapes is usually a few dozen
+  bytes instead of the 2560 bytes of a raw frame.
+
+  extras/host/server.cpp shows how to build frames on the computer side.
+
+  To connect the display to an Arduino:
+  (Arduino pin) = (Display pin)
+  Pin 13 = SCLK on display carrier
+  11 = SDIN
+  10 = !CS
+  9 = !RES
+*/
+
+#include <SSD1320_OLED.h>
+#include <SSD1320_Server.h>
+
+//Initialize the display with the follow pin connections
+SSD1320 flexibleOLED(10, 9); //10 = CS, 9 = RES
+
+SSD1320_Server server(flexibleOLED, Serial);
+
+void setup()
+{
+  Serial.begin(115200);
+
+  flexibleOLED.begin(160, 32); //Display is 160 wide, 32 high
+
+  flexibleOLED.clearDisplay();
+  flexibleOLED.setCursor(0, 0);
+  flexibleOLED.print("Waiting for host");
+  flexibleOLED.display();
+}
+
+void loop()
+{
+  server.update();
+}
@@ -0,0 +1,52 @@
+/*
+  Control a SSD1320 based flexible OLED display
+  SparkFun Electronics
+  License: This code is public domain but you buy me a beer if you use this and we meet someday (Beerware license).
+
+  Draw in all 16 gray levels. A whole 4-bit frame needs 2560 bytes of RAM, more than an
+  Uno has, so displayBanded() renders and sends it a few rows at a time instead. drawFrame()
+  is called once for each band and must draw the same picture every time.
+
+  To connect the display to an Arduino:
+  (Arduino pin) = (Display pin)
+  Pin 13 = SCLK on display carrier
+  11 = SDIN
+  10 = !CS
+  9 = !RES
+*/
+
+#include <SSD1320_OLED.h>
+
+//Initialize the display with the follow pin connections
+SSD1320 flexibleOLED(10, 9); //10 = CS, 9 = RES
+
+int ballX = 80;
+
+void setup()
+{
+  flexibleOLED.begin(160, 32); //Display is 160 wide, 32 high
+}
+
+//Draw the whole frame. top and rows say which band is being rendered,
+//drawing outside it is simply dropped.
+void drawFrame(uint8_t top, uint8_t rows)
+{
+  //Gray ramp across the screen
+  for (uint8_t level = 0 ; level < 16 ; level++)
+    flexibleOLED.rectFill(level * 10, 0, 10, 8, GRAY(level), NORM);
+
+  flexibleOLED.setColor(GRAY(4));
+  flexibleOLED.circleFill(ballX, 20, 8);
+
+  flexibleOLED.setColor(WHITE);
+  flexibleOLED.setCursor(0, 12);
+  flexibleOLED.print("16 grays");
+}
+
+void loop()
+{
+  ballX += 2;
+  if (ballX > 150) ballX = 60;
+
+  flexibleOLED.displayBanded(drawFrame);
+}
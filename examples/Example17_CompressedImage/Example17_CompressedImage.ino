@@ -0,0 +1,55 @@
+/*
+  Control a SSD1320 based flexible OLED display
+  SparkFun Electronics
+  License: This code is public domain but you buy me a beer if you use this and we meet someday (Beerware license).
+
+  Show compressed images. The raw che.h from Example2_Graphics takes 2560 bytes of flash,
+  che_packed.h 1766. Flat art like dashboard.h shrinks much more: 380 bytes for a full
+  16 gray screen. displayImage() decodes them straight into the display a row at a time,
+  so no extra RAM is needed.
+
+  Make your own with extras/tools/ssd1320_image.py:
+    python3 ssd1320_image.py picture.bmp -o picture.h
+
+  To connect the display to an Arduino:
+  (Arduino pin) = (Display pin)
+  Pin 13 = SCLK on display carrier
+  11 = SDIN
+  10 = !CS
+  9 = !RES
+*/
+
+#include <SSD1320_OLED.h>
+#include "che_packed.h" //The comic che, compressed
+#include "dashboard.h" //Meters and a battery
+
+//Initialize the display with the follow pin connections
+SSD1320 flexibleOLED(10, 9); //10 = CS, 9 = RES
+
+void setup()
+{
+  flexibleOLED.begin(160, 32); //Display is 160 wide, 32 high
+  flexibleOLED.clearDisplay(); //Clear display and buffer
+}
+
+void loop()
+{
+  flexibleOLED.displayImage(che);
+  delay(2000);
+
+  flexibleOLED.displayImage(dashboard);
+  delay(2000);
+
+  //drawImage() puts an image in the screen buffer, in black and white, so shapes and text
+  //can go on top. Here the battery fills up.
+  for (uint8_t level = 0 ; level <= 28 ; level += 4)
+  {
+    flexibleOLED.clearDisplay(CLEAR_BUFFER);
+    flexibleOLED.drawImage(dashboard);
+    flexibleOLED.rectFill(120, 12, 28, 8, BLACK, NORM); //Empty the battery
+    if (level > 0) flexibleOLED.rectFill(120, 12, level, 8, WHITE, NORM);
+    flexibleOLED.display();
+    delay(250);
+  }
+  delay(2000);
+}
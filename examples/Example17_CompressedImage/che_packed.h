@@ -0,0 +1,116 @@
+/* Made by extras/tools/ssd1320_image.py from che.h
+   160x32, 4 bits per pixel, PackBits: 1766 bytes (2560 raw). See SSD1320_Image.h */
+
+static const uint8_t che[1766] PROGMEM = {
+  0x84, 0xa0, 0x20, 0x01, 0x0f, 0xf0, 0xfd, 0x44, 0x01, 0x84, 0xa9, 0xfa, 0xaa, 0x04, 0x6a, 0x44,
+  0x44, 0x54, 0xa9, 0xfa, 0xaa, 0x0e, 0x6a, 0x25, 0x22, 0x22, 0x23, 0xb9, 0x4b, 0xa2, 0x7b, 0x11,
+  0x71, 0x28, 0xc8, 0x7c, 0x82, 0xf8, 0xcc, 0xf7, 0xdd, 0x03, 0x6d, 0x33, 0x33, 0x93, 0xfe, 0xaa,
+  0xfe, 0x99, 0x00, 0xa9, 0xfd, 0xbb, 0x00, 0x49, 0xfe, 0x44, 0x00, 0x32, 0xfc, 0x44, 0x00, 0x84,
+  0xf9, 0xaa, 0x04, 0x6a, 0x44, 0x54, 0x54, 0xa9, 0xfb, 0xaa, 0x0f, 0xba, 0x6a, 0x25, 0x22, 0x22,
+  0x78, 0xbb, 0x9b, 0xb8, 0x7c, 0x12, 0x72, 0x49, 0xc9, 0xac, 0xa5, 0xfa, 0xcc, 0x00, 0xdc, 0xf6,
+  0xdd, 0x03, 0x6d, 0x33, 0x33, 0x94, 0xfe, 0xaa, 0x03, 0xa9, 0xaa, 0x9a, 0xa9, 0xfd, 0xbb, 0x04,
+  0x48, 0x44, 0x43, 0x44, 0x32, 0xfc, 0x44, 0x00, 0x84, 0xfb, 0xaa, 0x05, 0x99, 0x99, 0x59, 0x44,
+  0x44, 0x54, 0xfd, 0x88, 0xfe, 0x77, 0x0e, 0xb8, 0x5a, 0x25, 0x22, 0x22, 0xba, 0x3a, 0xc6, 0xcb,
+  0x7c, 0x22, 0x72, 0xcc, 0x7c, 0xc6, 0xf9, 0xcc, 0xf5, 0xdd, 0x03, 0x6d, 0x33, 0x33, 0x94, 0xfb,
+  0xaa, 0x00, 0xb9, 0xfd, 0xbb, 0x00, 0x46, 0xfe, 0x44, 0x00, 0x32, 0xfc, 0x44, 0x03, 0x74, 0x9a,
+  0x66, 0x56, 0xfe, 0x55, 0x05, 0x45, 0x55, 0x55, 0x54, 0x44, 0x54, 0xfa, 0x55, 0x0e, 0xb8, 0x5a,
+  0x25, 0x22, 0x22, 0xba, 0x3a, 0xc7, 0xcc, 0x8c, 0x22, 0x72, 0xcc, 0x3b, 0xb3, 0xfa, 0xcc, 0x00,
+  0xdc, 0xf6, 0xdd, 0x04, 0xed, 0x5d, 0x33, 0x33, 0x94, 0xfa, 0xaa, 0xfe, 0xbb, 0x00, 0xab, 0xfd,
+  0x44, 0x00, 0x32, 0xfc, 0x44, 0x02, 0x64, 0x9a, 0x45, 0xf9, 0x44, 0x00, 0x45, 0xf9, 0x55, 0x0f,
+  0xba, 0x59, 0x25, 0x22, 0x22, 0x78, 0xbb, 0x9c, 0xb6, 0xac, 0x22, 0x72, 0xac, 0xac, 0xca, 0xc9,
+  0xfc, 0xcc, 0x01, 0xdc, 0xdc, 0xf5, 0xdd, 0x03, 0x4d, 0x33, 0x33, 0x94, 0xfb, 0xaa, 0x00, 0xba,
+  0xfe, 0xbb, 0x00, 0x8b, 0xfd, 0x44, 0x00, 0x32, 0xfc, 0x44, 0x02, 0x54, 0xaa, 0x46, 0xfa, 0x44,
+  0x02, 0x55, 0x55, 0x54, 0xfb, 0x55, 0x10, 0x65, 0xba, 0x57, 0x25, 0x22, 0x22, 0x23, 0xc9, 0x5c,
+  0xa2, 0xcc, 0x25, 0x72, 0x29, 0xc7, 0x8c, 0x72, 0xfc, 0xcc, 0x00, 0xdc, 0xf5, 0xdd, 0x04, 0xee,
+  0x4c, 0x33, 0x33, 0xa4, 0xfb, 0xaa, 0x00, 0xba, 0xfe, 0xbb, 0x00, 0x5a, 0xfd, 0x44, 0x00, 0x31,
+  0xfc, 0x44, 0x02, 0x54, 0xa9, 0x47, 0xfa, 0x44, 0xf8, 0x55, 0x10, 0x85, 0xbb, 0x56, 0x25, 0x22,
+  0x22, 0x89, 0xbb, 0xab, 0xc9, 0xcc, 0x4b, 0x72, 0x4a, 0xc9, 0xbc, 0xa6, 0xfd, 0xcc, 0x01, 0xdc,
+  0xcc, 0xf5, 0xdd, 0x04, 0xee, 0x4b, 0x33, 0x33, 0xa5, 0xfb, 0xaa, 0xfd, 0xbb, 0x05, 0x47, 0x44,
+  0x44, 0x43, 0x44, 0x22, 0xfb, 0x44, 0x01, 0xa8, 0x48, 0xfb, 0x44, 0x01, 0x54, 0x54, 0xf9, 0x55,
+  0x08, 0xa6, 0x9b, 0x55, 0x25, 0x22, 0x22, 0xca, 0x3a, 0xc6, 0xfe, 0xcc, 0x03, 0xa9, 0xcc, 0x7c,
+  0xc6, 0xfc, 0xcc, 0xf3, 0xdd, 0x04, 0xee, 0x3a, 0x33, 0x33, 0xa5, 0xfb, 0xaa, 0xfe, 0xbb, 0x00,
+  0x9b, 0xfc, 0x44, 0x00, 0x21, 0xfb, 0x44, 0x01, 0xa6, 0x5a, 0xfd, 0x44, 0x00, 0x54, 0xfd, 0x55,
+  0x0f, 0x65, 0x66, 0x76, 0x77, 0x77, 0x87, 0x88, 0xb9, 0x7b, 0x55, 0x25, 0x22, 0x22, 0xca, 0x4b,
+  0xc7, 0xfc, 0xcc, 0x01, 0x4c, 0xc3, 0xfb, 0xcc, 0x04, 0x7a, 0x45, 0x54, 0x96, 0xdc, 0xfb, 0xdd,
+  0x06, 0xed, 0xee, 0xee, 0x39, 0x33, 0x33, 0xa6, 0xfc, 0xaa, 0x00, 0xba, 0xfe, 0xbb, 0x06, 0x5a,
+  0x44, 0x44, 0x64, 0x44, 0x44, 0x22, 0xfb, 0x44, 0x06, 0x95, 0x9a, 0x88, 0x88, 0x99, 0x99, 0xa9,
+  0xfd, 0xaa, 0x00, 0xab, 0xfa, 0xbb, 0x08, 0x5a, 0x55, 0x25, 0x22, 0x22, 0x68, 0xcb, 0x9c, 0xb6,
+  0xfe, 0xcc, 0x03, 0xac, 0xbc, 0xcb, 0xb9, 0xfd, 0xcc, 0x06, 0x48, 0x22, 0x32, 0x23, 0x33, 0x73,
+  0xdc, 0xfc, 0xdd, 0x06, 0xed, 0xee, 0xde, 0x37, 0x33, 0x33, 0xa7, 0xfb, 0xaa, 0x09, 0xbb, 0xbb,
+  0xab, 0x45, 0x44, 0x44, 0x66, 0x44, 0x44, 0x22, 0xfb, 0x44, 0x00, 0x64, 0xf8, 0xaa, 0x01, 0xba,
+  0xbb, 0xfc, 0xaa, 0x0a, 0xb9, 0xbb, 0x57, 0x55, 0x25, 0x22, 0x22, 0x23, 0xc9, 0x5c, 0xa2, 0xfe,
+  0xcc, 0x03, 0x29, 0xc7, 0x9c, 0x72, 0xfe, 0xcc, 0x00, 0x6c, 0xfd, 0x22, 0x02, 0x32, 0x33, 0xc5,
+  0xfc, 0xdd, 0x06, 0xed, 0xee, 0xde, 0x35, 0x33, 0x33, 0xa7, 0xfb, 0xaa, 0x0a, 0xbb, 0xbb, 0xab,
+  0x45, 0x44, 0x54, 0x68, 0x44, 0x44, 0x12, 0x43, 0xfc, 0x44, 0x0b, 0x54, 0xa9, 0x8a, 0x88, 0x78,
+  0x77, 0x67, 0x66, 0xa6, 0xba, 0xbb, 0x9b, 0xfc, 0x55, 0x0a, 0xb7, 0x9b, 0x55, 0x55, 0x25, 0x22,
+  0x22, 0x89, 0xbc, 0xbb, 0xca, 0xfe, 0xcc, 0x03, 0x5b, 0xc9, 0xbc, 0xa6, 0xfe, 0xcc, 0x00, 0x28,
+  0xfc, 0x22, 0x01, 0x33, 0x73, 0xfb, 0xdd, 0x05, 0xee, 0xde, 0x34, 0x33, 0x33, 0xa8, 0xfb, 0xaa,
+  0xfe, 0xbb, 0x07, 0x46, 0x44, 0x74, 0x68, 0x44, 0x44, 0x12, 0x43, 0xfb, 0x44, 0x0a, 0xa6, 0x8a,
+  0x45, 0x55, 0x44, 0x54, 0x55, 0xa5, 0xaa, 0xbb, 0x9b, 0xfd, 0x55, 0x0a, 0x65, 0xbb, 0x6a, 0x55,
+  0x55, 0x25, 0x22, 0x22, 0xb4, 0x3b, 0xc5, 0xfc, 0xcc, 0x06, 0x8c, 0xc5, 0xcc, 0xcc, 0xdc, 0xdd,
+  0x25, 0xfc, 0x22, 0x01, 0x33, 0x43, 0xfc, 0xdd, 0x06, 0xed, 0xee, 0xce, 0x33, 0x33, 0x43, 0xa9,
+  0xfb, 0xaa, 0xfe, 0xbb, 0x07, 0x47, 0x34, 0x74, 0x68, 0x44, 0x44, 0x11, 0x32, 0xfb, 0x44, 0x0a,
+  0x74, 0xaa, 0x58, 0x54, 0x44, 0x55, 0x55, 0xa5, 0xbb, 0xbb, 0x9b, 0xfd, 0x55, 0x0a, 0xa6, 0xbb,
+  0x57, 0x55, 0x55, 0x35, 0x22, 0x22, 0x32, 0x59, 0xc7, 0xfc, 0xcc, 0x02, 0x5c, 0xb3, 0xcc, 0xfe,
+  0xdd, 0x00, 0x25, 0xfc, 0x22, 0x01, 0x33, 0x53, 0xfc, 0xdd, 0x06, 0xed, 0xee, 0xae, 0x33, 0x33,
+  0x43, 0xa9, 0xfc, 0xaa, 0x00, 0xba, 0xfe, 0xbb, 0x08, 0x48, 0x33, 0x74, 0x68, 0x44, 0x44, 0x11,
+  0x11, 0x32, 0xfc, 0x44, 0x0a, 0x54, 0xa8, 0x9a, 0x55, 0x45, 0x45, 0x55, 0xa5, 0xaa, 0xaa, 0x8a,
+  0xfe, 0x55, 0x02, 0x75, 0xba, 0x8b, 0xfe, 0x55, 0x00, 0x45, 0xfe, 0x22, 0x02, 0x93, 0x9c, 0xb5,
+  0xfe, 0xcc, 0x02, 0xac, 0xcc, 0xdb, 0xfd, 0xdd, 0x00, 0x29, 0xfc, 0x22, 0x01, 0x33, 0x93, 0xfc,
+  0xdd, 0x05, 0xee, 0xee, 0x8e, 0x33, 0x33, 0x53, 0xfa, 0xaa, 0x08, 0xba, 0xbb, 0xbb, 0x48, 0x33,
+  0x74, 0x58, 0x44, 0x44, 0xfe, 0x11, 0x00, 0x42, 0xfc, 0x44, 0x02, 0x95, 0xaa, 0x69, 0xf7, 0x55,
+  0x02, 0xb8, 0xbb, 0x58, 0xfd, 0x55, 0x00, 0x24, 0xfe, 0x22, 0x01, 0x69, 0xa2, 0xfe, 0xcc, 0x01,
+  0x3a, 0xc6, 0xfc, 0xdd, 0x01, 0x7d, 0x23, 0xfe, 0x22, 0x02, 0x33, 0x33, 0xd8, 0xfc, 0xdd, 0x05,
+  0xee, 0xee, 0x7e, 0x33, 0x33, 0x53, 0xfb, 0xaa, 0x00, 0xba, 0xfe, 0xbb, 0x09, 0x37, 0x33, 0x74,
+  0x58, 0x43, 0x44, 0x57, 0x12, 0x11, 0x21, 0xfc, 0x44, 0x03, 0x54, 0xa9, 0xaa, 0x58, 0xf9, 0x55,
+  0x02, 0x96, 0xbb, 0x7b, 0xfc, 0x55, 0x00, 0x45, 0xfe, 0x22, 0x01, 0x82, 0xca, 0xfe, 0xcc, 0x01,
+  0x6c, 0xd9, 0xfb, 0xdd, 0x05, 0x5a, 0x33, 0x32, 0x33, 0x33, 0xb6, 0xfb, 0xdd, 0x05, 0xed, 0xee,
+  0x5d, 0x33, 0x33, 0x63, 0xfb, 0xaa, 0x0e, 0xba, 0xbb, 0xbb, 0xab, 0x35, 0x33, 0x74, 0x58, 0x33,
+  0x44, 0x99, 0x58, 0x11, 0x11, 0x42, 0xfc, 0x44, 0x03, 0x85, 0xaa, 0xaa, 0x57, 0xfb, 0x55, 0x03,
+  0x86, 0xbb, 0xab, 0x56, 0xfb, 0x55, 0x00, 0x12, 0xfe, 0x22, 0x04, 0xc8, 0xcc, 0xcc, 0xcd, 0xcd,
+  0xf9, 0xdd, 0x03, 0x9c, 0x78, 0x87, 0xca, 0xfa, 0xdd, 0x05, 0xed, 0xee, 0x4d, 0x33, 0x33, 0x73,
+  0xfb, 0xaa, 0x0e, 0xba, 0xbb, 0xbb, 0x9b, 0x34, 0x33, 0x85, 0x58, 0x33, 0x44, 0x99, 0x99, 0x16,
+  0x11, 0x21, 0xfb, 0x44, 0x03, 0x96, 0xaa, 0xab, 0x79, 0xfe, 0x55, 0x04, 0x65, 0x97, 0xbb, 0xbb,
+  0x58, 0xfa, 0x55, 0x07, 0x22, 0x22, 0x12, 0x22, 0x72, 0xcc, 0xcc, 0xdc, 0xed, 0xdd, 0x05, 0xee,
+  0xee, 0x3b, 0x33, 0x33, 0x93, 0xfa, 0xaa, 0x0b, 0xba, 0xbb, 0x5a, 0x33, 0x43, 0x86, 0x47, 0x33,
+  0x33, 0x68, 0x34, 0x12, 0xfd, 0x11, 0x0e, 0x21, 0x22, 0x33, 0x44, 0x54, 0xa7, 0xbb, 0xbb, 0xab,
+  0x9a, 0xa9, 0xba, 0xbb, 0xbb, 0x69, 0xf9, 0x55, 0x07, 0x22, 0x22, 0x12, 0x22, 0x22, 0xc6, 0xcc,
+  0xdc, 0xed, 0xdd, 0x05, 0xee, 0xee, 0x3a, 0x33, 0x33, 0x94, 0xf9, 0xaa, 0x07, 0xab, 0x36, 0x33,
+  0x43, 0x77, 0x47, 0x33, 0x33, 0xf7, 0x11, 0x04, 0x21, 0x32, 0x54, 0x86, 0xba, 0xfd, 0xbb, 0x01,
+  0x9b, 0x68, 0xf8, 0x55, 0x06, 0x22, 0x22, 0x21, 0x22, 0x22, 0x52, 0xdc, 0xed, 0xdd, 0x06, 0xed,
+  0xee, 0xee, 0x38, 0x33, 0x33, 0xa5, 0xf9, 0xaa, 0x07, 0x5a, 0x33, 0x33, 0x63, 0x78, 0x47, 0x33,
+  0x33, 0xf5, 0x11, 0x06, 0x21, 0x43, 0x65, 0x87, 0x88, 0x88, 0x67, 0xf6, 0x55, 0x01, 0x12, 0x11,
+  0xfd, 0x22, 0x00, 0xc5, 0xed, 0xdd, 0xfe, 0xee, 0x03, 0x36, 0x33, 0x33, 0xa6, 0xfa, 0xaa, 0x08,
+  0x7a, 0x34, 0x33, 0x33, 0x74, 0x87, 0x47, 0x33, 0x33, 0xf3, 0x11, 0x01, 0x32, 0x54, 0xf3, 0x55,
+  0x07, 0x22, 0x21, 0x22, 0x12, 0x22, 0x22, 0x42, 0xdb, 0xef, 0xdd, 0x07, 0xed, 0xee, 0xee, 0xde,
+  0x34, 0x33, 0x33, 0xa7, 0xfa, 0xaa, 0x08, 0x46, 0x33, 0x33, 0x43, 0x77, 0x77, 0x37, 0x33, 0x33,
+  0xfa, 0x11, 0x02, 0x55, 0x45, 0x23, 0xfc, 0x11, 0x01, 0x32, 0x54, 0xf5, 0x55, 0x00, 0x45, 0xfe,
+  0x11, 0x00, 0x12, 0xfe, 0x22, 0x00, 0xb4, 0xee, 0xdd, 0x06, 0xed, 0xee, 0xce, 0x34, 0x33, 0x33,
+  0xa8, 0xfa, 0xaa, 0x14, 0x34, 0x33, 0x33, 0x74, 0x77, 0x77, 0x37, 0x33, 0x33, 0x21, 0x43, 0x76,
+  0x88, 0x13, 0x11, 0x11, 0x73, 0x77, 0x77, 0x56, 0x23, 0xfd, 0x11, 0x00, 0x42, 0xf5, 0x55, 0x09,
+  0x25, 0x11, 0x12, 0x11, 0x21, 0x11, 0x22, 0x22, 0x32, 0xdb, 0xef, 0xdd, 0x06, 0xed, 0xee, 0xbe,
+  0x33, 0x33, 0x43, 0xa9, 0xfb, 0xaa, 0x03, 0x8a, 0x33, 0x33, 0x53, 0xfe, 0x77, 0x03, 0x36, 0x33,
+  0x43, 0x87, 0xfe, 0x99, 0x03, 0x28, 0x11, 0x11, 0x51, 0xfd, 0x77, 0x05, 0x46, 0x12, 0x11, 0x11,
+  0x21, 0x53, 0xf6, 0x55, 0x05, 0x24, 0x12, 0x11, 0x11, 0x21, 0x12, 0xfe, 0x22, 0x00, 0xa3, 0xef,
+  0xdd, 0x05, 0xee, 0xed, 0x9e, 0x33, 0x33, 0x53, 0xfa, 0xaa, 0x03, 0x5a, 0x33, 0x33, 0x76, 0xfe,
+  0x77, 0x02, 0x36, 0x33, 0x43, 0xfd, 0x99, 0x04, 0x79, 0x11, 0x11, 0x21, 0x76, 0xfd, 0x77, 0x05,
+  0x57, 0x13, 0x11, 0x11, 0x21, 0x54, 0xf7, 0x55, 0x00, 0x23, 0xfe, 0x11, 0x06, 0x22, 0x11, 0x12,
+  0x22, 0x22, 0x32, 0xd9, 0xf0, 0xdd, 0x05, 0xed, 0xed, 0x7e, 0x33, 0x33, 0x63, 0xfa, 0xaa, 0x02,
+  0x49, 0x33, 0x43, 0xfd, 0x77, 0x02, 0x35, 0x33, 0x43, 0xfc, 0x99, 0x03, 0x15, 0x11, 0x11, 0x73,
+  0xfd, 0x77, 0x05, 0x87, 0x57, 0x12, 0x11, 0x11, 0x42, 0xf8, 0x55, 0x01, 0x45, 0x12, 0xfd, 0x11,
+  0x01, 0x21, 0x21, 0xfe, 0x22, 0x00, 0x92, 0xf0, 0xdd, 0x05, 0xed, 0xed, 0x5d, 0x33, 0x33, 0x83,
+  0xfa, 0xaa, 0x02, 0x36, 0x33, 0x43, 0xfd, 0x77, 0x02, 0x35, 0x33, 0x43, 0xfc, 0x99, 0x03, 0x38,
+  0x11, 0x11, 0x51, 0xfc, 0x77, 0x05, 0x88, 0x47, 0x12, 0x11, 0x21, 0x54, 0xf9, 0x55, 0x00, 0x25,
+  0xfa, 0x11, 0x00, 0x21, 0xfe, 0x22, 0x00, 0xd8, 0xf1, 0xdd, 0x05, 0xed, 0xdd, 0x4d, 0x33, 0x33,
+  0x94, 0xfb, 0xaa, 0x03, 0x9a, 0x34, 0x33, 0x63, 0xfd, 0x77, 0x02, 0x34, 0x33, 0x53, 0xfc, 0x99,
+  0x03, 0x79, 0x11, 0x11, 0x21, 0xfc, 0x77, 0x05, 0x88, 0x88, 0x26, 0x11, 0x11, 0x42, 0xf9, 0x55,
+  0x00, 0x24, 0xfb, 0x11, 0x01, 0x21, 0x11, 0xfe, 0x22, 0x00, 0x72, 0xef, 0xdd, 0x03, 0x3b, 0x33,
+  0x33, 0xa5, 0xfb, 0xaa, 0x03, 0x5a, 0x33, 0x33, 0x74, 0xfd, 0x77, 0x02, 0x34, 0x33, 0x63, 0xfb,
+  0x99, 0x03, 0x14, 0x11, 0x11, 0x74, 0xfd, 0x77, 0x05, 0x88, 0x88, 0x78, 0x13, 0x11, 0x22, 0xf9,
+  0x55, 0x00, 0x22, 0xfa, 0x11, 0x00, 0x12, 0xfd, 0x22, 0x01, 0x65, 0x56, 0xfc, 0x55, 0x00, 0x45,
+  0xfb, 0x44, 0xfa, 0x33, 0x00, 0xa6, 0xfb, 0xaa, 0x03, 0x37, 0x33, 0x33, 0x76, 0xfd, 0x77, 0x02,
+  0x33, 0x33, 0x63, 0xfd, 0x99, 0x09, 0x89, 0x46, 0x12, 0x11, 0x11, 0x31, 0x75, 0x77, 0x77, 0x87,
+  0xfe, 0x88, 0x03, 0x37, 0x11, 0x21, 0x53, 0xfb, 0x55, 0x01, 0x35, 0x22, 0xf9, 0x11, 0xf5, 0x22,
+  0x01, 0x32, 0x32, 0xf6, 0x33, 0x00, 0xa8, 0xfc, 0xaa, 0x0b, 0x9a, 0x34, 0x33, 0x43, 0x77, 0x77,
+  0x87, 0x99, 0x89, 0x34, 0x33, 0x84,
+};
@@ -0,0 +1,29 @@
+/* Made by extras/tools/ssd1320_image.py from dashboard.pgm
+   160x32, 4 bits per pixel, PackBits: 380 bytes (2560 raw). See SSD1320_Image.h */
+
+static const uint8_t dashboard[380] PROGMEM = {
+  0x84, 0xa0, 0x20, 0x81, 0xff, 0xe0, 0xff, 0xb3, 0x00, 0x01, 0xff, 0xff, 0xb3, 0x00, 0x01, 0xff,
+  0xff, 0xb3, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0xd2, 0xff, 0x00, 0x2f, 0xe6, 0x00, 0x01, 0xff,
+  0xff, 0xfe, 0x00, 0xd2, 0xff, 0x00, 0x2f, 0xe6, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0xd2, 0xff,
+  0x00, 0x2f, 0xe6, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0xd2, 0xff, 0x00, 0x2f, 0xfb, 0x00, 0xf0,
+  0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0xd2, 0xff, 0x00, 0x2f, 0xfb, 0x00, 0xf0, 0xff,
+  0xfd, 0x00, 0x01, 0xff, 0xff, 0xc8, 0x00, 0x00, 0xff, 0xf2, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x01,
+  0xff, 0xff, 0xc8, 0x00, 0x00, 0xff, 0xf2, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xc8,
+  0x00, 0x01, 0xff, 0x00, 0xf7, 0xaa, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfe,
+  0x00, 0xed, 0x99, 0xe5, 0x22, 0xfb, 0x00, 0x01, 0xff, 0x00, 0xf7, 0xaa, 0xfd, 0x00, 0x06, 0xff,
+  0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x00, 0xed, 0x99, 0xe5, 0x22, 0xfb, 0x00, 0x01, 0xff,
+  0x00, 0xf7, 0xaa, 0xfd, 0x00, 0x06, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x00, 0xed,
+  0x99, 0xe5, 0x22, 0xfb, 0x00, 0x01, 0xff, 0x00, 0xf7, 0xaa, 0xfd, 0x00, 0x06, 0xff, 0xff, 0x0f,
+  0x00, 0x00, 0xff, 0xff, 0xfe, 0x00, 0xed, 0x99, 0xe5, 0x22, 0xfb, 0x00, 0x01, 0xff, 0x00, 0xf7,
+  0xaa, 0xfd, 0x00, 0x06, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x00, 0xed, 0x99, 0xe5,
+  0x22, 0xfb, 0x00, 0x01, 0xff, 0x00, 0xf7, 0xaa, 0xfd, 0x00, 0x06, 0xff, 0xff, 0x0f, 0x00, 0x00,
+  0xff, 0xff, 0xc8, 0x00, 0x01, 0xff, 0x00, 0xf7, 0xaa, 0xfd, 0x00, 0x06, 0xff, 0xff, 0x0f, 0x00,
+  0x00, 0xff, 0xff, 0xc8, 0x00, 0x01, 0xff, 0x00, 0xf7, 0xaa, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00,
+  0x01, 0xff, 0xff, 0xc8, 0x00, 0x00, 0xff, 0xf2, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff,
+  0xfe, 0x00, 0xde, 0x44, 0xf4, 0x22, 0xfb, 0x00, 0x00, 0xff, 0xf2, 0x00, 0x00, 0xff, 0xfd, 0x00,
+  0x01, 0xff, 0xff, 0xfe, 0x00, 0xde, 0x44, 0xf4, 0x22, 0xfb, 0x00, 0xf0, 0xff, 0xfd, 0x00, 0x01,
+  0xff, 0xff, 0xfe, 0x00, 0xde, 0x44, 0xf4, 0x22, 0xfb, 0x00, 0xf0, 0xff, 0xfd, 0x00, 0x01, 0xff,
+  0xff, 0xfe, 0x00, 0xde, 0x44, 0xf4, 0x22, 0xe6, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0xde, 0x44,
+  0xf4, 0x22, 0xe6, 0x00, 0x01, 0xff, 0xff, 0xb3, 0x00, 0x01, 0xff, 0xff, 0xb3, 0x00, 0x01, 0xff,
+  0xff, 0xb3, 0x00, 0x01, 0xff, 0xff, 0xb3, 0x00, 0x81, 0xff, 0xe0, 0xff,
+};
@@ -0,0 +1,52 @@
+/*
+  Control a SSD1320 based flexible OLED display
+  SparkFun Electronics
+  License: This code is public domain but you buy me a beer if you use this and we meet someday (Beerware license).
+
+  Play a boot animation. Its 40 frames would take 25600 bytes as full screens, stored as
+  changes from one frame to the next they take 1531, and only the changed parts of the
+  display are sent each frame.
+
+  Make your own from a folder of BMP or PGM frames with extras/tools/ssd1320_animation.py:
+    python3 ssd1320_animation.py --fps 20 --name bootAnimation frame*.bmp -o bootAnimation.h
+
+  To connect the display to an Arduino:
+  (Arduino pin) = (Display pin)
+  Pin 13 = SCLK on display carrier
+  11 = SDIN
+  10 = !CS
+  9 = !RES
+*/
+
+#include <SSD1320_OLED.h>
+#include <SSD1320_Animation.h>
+#include "bootAnimation.h" //A ball bouncing over a progress bar
+
+//Initialize the display with the follow pin connections
+SSD1320 flexibleOLED(10, 9); //10 = CS, 9 = RES
+
+SSD1320_Animation animation(flexibleOLED);
+
+void setup()
+{
+  pinMode(LED_BUILTIN, OUTPUT);
+
+  flexibleOLED.begin(160, 32); //Display is 160 wide, 32 high
+  flexibleOLED.clearDisplay(); //Clear display and buffer
+
+  //Play it once, waiting until it is done
+  animation.begin(bootAnimation);
+  animation.play();
+
+  //Then keep it going at double speed while loop() does other work
+  animation.begin(bootAnimation);
+  animation.setFrameRate(40);
+  animation.setLoop(true);
+}
+
+void loop()
+{
+  animation.update(); //Draws a frame only when one is due
+
+  digitalWrite(LED_BUILTIN, (millis() / 500) % 2);
+}
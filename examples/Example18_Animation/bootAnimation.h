@@ -0,0 +1,101 @@
+/* Made by extras/tools/ssd1320_animation.py from 40 frames
+   160x32, 1 bits per pixel, 50 ms per frame: 1531 bytes (25600 as full frames). See SSD1320_Animation.h */
+
+static const uint8_t bootAnimation[1531] PROGMEM = {
+  0x01, 0xa0, 0x20, 0x28, 0x00, 0x32, 0x00, 0x01, 0x00, 0x00, 0x14, 0x20, 0xd7, 0x00, 0x00, 0x0f,
+  0xf3, 0xff, 0x00, 0xf0, 0xfd, 0x00, 0x00, 0x08, 0xf3, 0x00, 0x00, 0x10, 0xfd, 0x00, 0x00, 0x0b,
+  0xf3, 0x00, 0x00, 0x10, 0xfd, 0x00, 0x00, 0x0b, 0xf3, 0x00, 0x00, 0x10, 0xfd, 0x00, 0x00, 0x08,
+  0xf3, 0x00, 0x00, 0x10, 0xfd, 0x00, 0x00, 0x0f, 0xf3, 0xff, 0x00, 0xf0, 0xea, 0x00, 0x00, 0x08,
+  0xee, 0x00, 0x00, 0x3e, 0xee, 0x00, 0x00, 0x7f, 0xee, 0x00, 0x00, 0x7f, 0xee, 0x00, 0x01, 0xff,
+  0x80, 0xef, 0x00, 0x00, 0x7f, 0xee, 0x00, 0x00, 0x7f, 0xee, 0x00, 0x00, 0x3e, 0xee, 0x00, 0x00,
+  0x08, 0x81, 0x00, 0x81, 0x00, 0xd7, 0x00, 0x01, 0x01, 0x04, 0x03, 0x12, 0x0b, 0x00, 0x0b, 0xe0,
+  0x00, 0x0b, 0xe0, 0x00, 0x08, 0x00, 0x00, 0x0f, 0xff, 0xf2, 0x00, 0x1a, 0x01, 0x00, 0x00, 0x07,
+  0xc0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x1f, 0xf0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0,
+  0x00, 0x07, 0xc0, 0x00, 0x01, 0x00, 0x00, 0x02, 0x03, 0x04, 0x01, 0x02, 0x01, 0xfc, 0xfc, 0x01,
+  0x0d, 0x02, 0x0c, 0xfa, 0x00, 0x10, 0x20, 0x00, 0xf8, 0x01, 0xfc, 0x01, 0xfc, 0x03, 0xfe, 0x01,
+  0xfc, 0x01, 0xfc, 0x00, 0xf8, 0x00, 0x20, 0x02, 0x03, 0x04, 0x02, 0x02, 0x03, 0xff, 0x80, 0xff,
+  0x80, 0x01, 0x10, 0x03, 0x0c, 0xf7, 0x00, 0x19, 0x02, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x1f, 0xc0,
+  0x00, 0x1f, 0xc0, 0x00, 0x3f, 0xe0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x0f, 0x80, 0x00,
+  0x02, 0x00, 0x02, 0x04, 0x04, 0x01, 0x02, 0x01, 0xf0, 0xf0, 0x02, 0x13, 0x02, 0x0b, 0xfc, 0x00,
+  0x10, 0x40, 0x01, 0xf0, 0x03, 0xf8, 0x03, 0xf8, 0x07, 0xfc, 0x03, 0xf8, 0x03, 0xf8, 0x01, 0xf0,
+  0x00, 0x40, 0x02, 0x04, 0x04, 0x01, 0x02, 0x01, 0xfe, 0xfe, 0x02, 0x15, 0x03, 0x0a, 0xfd, 0x00,
+  0x19, 0x04, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x7f, 0xc0, 0x00,
+  0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x1f, 0x00, 0x00, 0x04, 0x00, 0x02, 0x04, 0x04, 0x02, 0x02,
+  0x03, 0xff, 0xc0, 0xff, 0xc0, 0x03, 0x16, 0x02, 0x0a, 0xfe, 0x00, 0x10, 0x80, 0x03, 0xe0, 0x07,
+  0xf0, 0x07, 0xf0, 0x0f, 0xf8, 0x07, 0xf0, 0x07, 0xf0, 0x03, 0xe0, 0x00, 0x80, 0x02, 0x05, 0x04,
+  0x01, 0x02, 0x01, 0xf8, 0xf8, 0x03, 0x17, 0x02, 0x09, 0x11, 0x00, 0x10, 0x00, 0x7c, 0x00, 0xfe,
+  0x00, 0xfe, 0x01, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0x7c, 0x00, 0x10, 0x02, 0x05, 0x04, 0x01,
+  0x02, 0x01, 0xff, 0xff, 0x03, 0x17, 0x03, 0x09, 0x1a, 0x00, 0x01, 0x00, 0x00, 0x07, 0xc0, 0x00,
+  0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x1f, 0xf0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x07,
+  0xc0, 0x00, 0x01, 0x00, 0x02, 0x06, 0x04, 0x01, 0x02, 0x01, 0xe0, 0xe0, 0x04, 0x15, 0x02, 0x0b,
+  0x11, 0x00, 0x20, 0x00, 0xf8, 0x01, 0xfc, 0x01, 0xfc, 0x03, 0xfe, 0x01, 0xfc, 0x01, 0xfc, 0x00,
+  0xf8, 0x00, 0x20, 0xfd, 0x00, 0x02, 0x06, 0x04, 0x01, 0x02, 0x01, 0xf8, 0xf8, 0x04, 0x13, 0x03,
+  0x0b, 0x19, 0x00, 0x02, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x3f,
+  0xe0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x0f, 0x80, 0x00, 0x02, 0xfa, 0x00, 0x02, 0x06,
+  0x04, 0x01, 0x02, 0x01, 0xff, 0xff, 0x05, 0x11, 0x02, 0x0b, 0x11, 0x00, 0x40, 0x01, 0xf0, 0x03,
+  0xf8, 0x03, 0xf8, 0x07, 0xfc, 0x03, 0xf8, 0x03, 0xf8, 0x01, 0xf0, 0x00, 0x40, 0xfd, 0x00, 0x02,
+  0x07, 0x04, 0x01, 0x02, 0x01, 0xe0, 0xe0, 0x05, 0x0e, 0x03, 0x0c, 0x19, 0x00, 0x08, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0xff, 0x80, 0x00, 0x7f, 0x00, 0x00, 0x7f,
+  0x00, 0x00, 0x3e, 0x00, 0x00, 0x08, 0xf7, 0x00, 0x02, 0x07, 0x04, 0x01, 0x02, 0x01, 0xfc, 0xfc,
+  0x06, 0x0b, 0x02, 0x0c, 0x11, 0x00, 0x80, 0x03, 0xe0, 0x07, 0xf0, 0x07, 0xf0, 0x0f, 0xf8, 0x07,
+  0xf0, 0x07, 0xf0, 0x03, 0xe0, 0x00, 0x80, 0xfb, 0x00, 0x02, 0x07, 0x04, 0x02, 0x02, 0x03, 0xff,
+  0x80, 0xff, 0x80, 0x06, 0x0b, 0x02, 0x0a, 0xfe, 0x00, 0x10, 0x10, 0x00, 0x7c, 0x00, 0xfe, 0x00,
+  0xfe, 0x01, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0x7c, 0x00, 0x10, 0x02, 0x08, 0x04, 0x01, 0x02,
+  0x01, 0xf0, 0xf0, 0x06, 0x0c, 0x03, 0x0c, 0xf7, 0x00, 0x19, 0x01, 0x00, 0x00, 0x07, 0xc0, 0x00,
+  0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x1f, 0xf0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x07,
+  0xc0, 0x00, 0x01, 0x00, 0x02, 0x08, 0x04, 0x01, 0x02, 0x01, 0xfe, 0xfe, 0x07, 0x0f, 0x02, 0x0c,
+  0xfa, 0x00, 0x10, 0x20, 0x00, 0xf8, 0x01, 0xfc, 0x01, 0xfc, 0x03, 0xfe, 0x01, 0xfc, 0x01, 0xfc,
+  0x00, 0xf8, 0x00, 0x20, 0x02, 0x08, 0x04, 0x02, 0x02, 0x03, 0xff, 0xc0, 0xff, 0xc0, 0x07, 0x12,
+  0x03, 0x0b, 0xfa, 0x00, 0x19, 0x04, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80,
+  0x00, 0x7f, 0xc0, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x1f, 0x00, 0x00, 0x04, 0x00, 0x02,
+  0x09, 0x04, 0x01, 0x02, 0x01, 0xf8, 0xf8, 0x08, 0x14, 0x02, 0x0b, 0xfc, 0x00, 0x10, 0x40, 0x01,
+  0xf0, 0x03, 0xf8, 0x03, 0xf8, 0x07, 0xfc, 0x03, 0xf8, 0x03, 0xf8, 0x01, 0xf0, 0x00, 0x40, 0x02,
+  0x09, 0x04, 0x01, 0x02, 0x01, 0xff, 0xff, 0x08, 0x16, 0x03, 0x0a, 0xfd, 0x00, 0x19, 0x08, 0x00,
+  0x00, 0x3e, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0xff, 0x80, 0x00, 0x7f, 0x00, 0x00,
+  0x7f, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x08, 0x00, 0x02, 0x0a, 0x04, 0x01, 0x02, 0x01, 0xc0, 0xc0,
+  0x09, 0x17, 0x02, 0x09, 0x11, 0x00, 0x80, 0x03, 0xe0, 0x07, 0xf0, 0x07, 0xf0, 0x0f, 0xf8, 0x07,
+  0xf0, 0x07, 0xf0, 0x03, 0xe0, 0x00, 0x80, 0x02, 0x0a, 0x04, 0x01, 0x02, 0x01, 0xf8, 0xf8, 0x09,
+  0x17, 0x02, 0x09, 0x11, 0x00, 0x10, 0x00, 0x7c, 0x00, 0xfe, 0x00, 0xfe, 0x01, 0xff, 0x00, 0xfe,
+  0x00, 0xfe, 0x00, 0x7c, 0x00, 0x10, 0x02, 0x0a, 0x04, 0x01, 0x02, 0x01, 0xff, 0xff, 0x09, 0x16,
+  0x03, 0x0a, 0x19, 0x00, 0x02, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00,
+  0x3f, 0xe0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x0f, 0x80, 0x00, 0x02, 0xfd, 0x00, 0x02,
+  0x0b, 0x04, 0x01, 0x02, 0x01, 0xe0, 0xe0, 0x0a, 0x14, 0x02, 0x0b, 0x11, 0x00, 0x20, 0x00, 0xf8,
+  0x01, 0xfc, 0x01, 0xfc, 0x03, 0xfe, 0x01, 0xfc, 0x01, 0xfc, 0x00, 0xf8, 0x00, 0x20, 0xfd, 0x00,
+  0x02, 0x0b, 0x04, 0x01, 0x02, 0x01, 0xfc, 0xfc, 0x0a, 0x12, 0x03, 0x0b, 0x19, 0x00, 0x04, 0x00,
+  0x00, 0x1f, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x7f, 0xc0, 0x00, 0x3f, 0x80, 0x00,
+  0x3f, 0x80, 0x00, 0x1f, 0x00, 0x00, 0x04, 0xfa, 0x00, 0x02, 0x0b, 0x04, 0x02, 0x02, 0x03, 0xff,
+  0x80, 0xff, 0x80, 0x0b, 0x0f, 0x02, 0x0c, 0x11, 0x00, 0x40, 0x01, 0xf0, 0x03, 0xf8, 0x03, 0xf8,
+  0x07, 0xfc, 0x03, 0xf8, 0x03, 0xf8, 0x01, 0xf0, 0x00, 0x40, 0xfb, 0x00, 0x02, 0x0c, 0x04, 0x01,
+  0x02, 0x01, 0xf0, 0xf0, 0x0b, 0x0c, 0x03, 0x0c, 0x19, 0x00, 0x08, 0x00, 0x00, 0x3e, 0x00, 0x00,
+  0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0xff, 0x80, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x3e,
+  0x00, 0x00, 0x08, 0xf7, 0x00, 0x02, 0x0c, 0x04, 0x01, 0x02, 0x01, 0xfe, 0xfe, 0x0c, 0x0b, 0x02,
+  0x0a, 0x10, 0x01, 0x00, 0x07, 0xc0, 0x0f, 0xe0, 0x0f, 0xe0, 0x1f, 0xf0, 0x0f, 0xe0, 0x0f, 0xe0,
+  0x07, 0xc0, 0x01, 0xfe, 0x00, 0x02, 0x0c, 0x04, 0x02, 0x02, 0x03, 0xff, 0xc0, 0xff, 0xc0, 0x0c,
+  0x0b, 0x02, 0x0c, 0xfa, 0x00, 0x10, 0x10, 0x00, 0x7c, 0x00, 0xfe, 0x00, 0xfe, 0x01, 0xff, 0x00,
+  0xfe, 0x00, 0xfe, 0x00, 0x7c, 0x00, 0x10, 0x02, 0x0d, 0x04, 0x01, 0x02, 0x01, 0xf8, 0xf8, 0x0c,
+  0x0e, 0x03, 0x0c, 0xf7, 0x00, 0x19, 0x02, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x1f, 0xc0, 0x00, 0x1f,
+  0xc0, 0x00, 0x3f, 0xe0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x0f, 0x80, 0x00, 0x02, 0x00,
+  0x02, 0x0d, 0x04, 0x01, 0x02, 0x01, 0xfe, 0xfe, 0x0d, 0x11, 0x02, 0x0b, 0xfc, 0x00, 0x10, 0x20,
+  0x00, 0xf8, 0x01, 0xfc, 0x01, 0xfc, 0x03, 0xfe, 0x01, 0xfc, 0x01, 0xfc, 0x00, 0xf8, 0x00, 0x20,
+  0x02, 0x0d, 0x04, 0x02, 0x02, 0x03, 0xff, 0xc0, 0xff, 0xc0, 0x0d, 0x13, 0x03, 0x0b, 0xfa, 0x00,
+  0x19, 0x04, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x7f, 0xc0, 0x00,
+  0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x1f, 0x00, 0x00, 0x04, 0x00, 0x02, 0x0e, 0x04, 0x01, 0x02,
+  0x01, 0xf8, 0xf8, 0x0e, 0x15, 0x02, 0x0b, 0xfc, 0x00, 0x10, 0x80, 0x03, 0xe0, 0x07, 0xf0, 0x07,
+  0xf0, 0x0f, 0xf8, 0x07, 0xf0, 0x07, 0xf0, 0x03, 0xe0, 0x00, 0x80, 0x02, 0x0e, 0x04, 0x01, 0x02,
+  0x01, 0xff, 0xff, 0x0e, 0x17, 0x03, 0x09, 0x1a, 0x00, 0x08, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x7f,
+  0x00, 0x00, 0x7f, 0x00, 0x00, 0xff, 0x80, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x3e, 0x00,
+  0x00, 0x08, 0x00, 0x02, 0x0f, 0x04, 0x01, 0x02, 0x01, 0xe0, 0xe0, 0x0f, 0x17, 0x02, 0x09, 0x11,
+  0x01, 0x00, 0x07, 0xc0, 0x0f, 0xe0, 0x0f, 0xe0, 0x1f, 0xf0, 0x0f, 0xe0, 0x0f, 0xe0, 0x07, 0xc0,
+  0x01, 0x00, 0x02, 0x0f, 0x04, 0x01, 0x02, 0x01, 0xfc, 0xfc, 0x0f, 0x16, 0x02, 0x0a, 0x13, 0x00,
+  0x10, 0x00, 0x7c, 0x00, 0xfe, 0x00, 0xfe, 0x01, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0x7c, 0x00,
+  0x10, 0x00, 0x00, 0x02, 0x0f, 0x04, 0x02, 0x02, 0x03, 0xff, 0x80, 0xff, 0x80, 0x0f, 0x15, 0x03,
+  0x0a, 0x19, 0x00, 0x02, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x3f,
+  0xe0, 0x00, 0x1f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x0f, 0x80, 0x00, 0x02, 0xfd, 0x00, 0x02, 0x10,
+  0x04, 0x01, 0x02, 0x01, 0xf0, 0xf0, 0x10, 0x13, 0x02, 0x0b, 0x11, 0x00, 0x40, 0x01, 0xf0, 0x03,
+  0xf8, 0x03, 0xf8, 0x07, 0xfc, 0x03, 0xf8, 0x03, 0xf8, 0x01, 0xf0, 0x00, 0x40, 0xfd, 0x00, 0x02,
+  0x10, 0x04, 0x01, 0x02, 0x01, 0xfe, 0xfe, 0x10, 0x10, 0x03, 0x0c, 0x19, 0x00, 0x04, 0x00, 0x00,
+  0x1f, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x7f, 0xc0, 0x00, 0x3f, 0x80, 0x00, 0x3f,
+  0x80, 0x00, 0x1f, 0x00, 0x00, 0x04, 0xf7, 0x00, 0x02, 0x10, 0x04, 0x02, 0x02, 0x03, 0xff, 0xd0,
+  0xff, 0xd0, 0x11, 0x0d, 0x02, 0x0c, 0x11, 0x00, 0x80, 0x03, 0xe0, 0x07, 0xf0, 0x07, 0xf0, 0x0f,
+  0xf8, 0x07, 0xf0, 0x07, 0xf0, 0x03, 0xe0, 0x00, 0x80, 0xfb, 0x00,
+};
@@ -0,0 +1,97 @@
+/*
+  Control a SSD1320 based flexible OLED display
+  SparkFun Electronics
+  License: This code is public domain but you buy me a beer if you use this and we meet someday (Beerware license).
+
+  Redraw a small dashboard every frame with cached labels. "TEMP", "RPM" and the units
+  never change, so SSD1320_Labels renders them once and then only copies their bits into
+  the screen buffer. The readings live in char buffers: their labels are rendered again
+  only when the text changes.
+
+  The time each frame takes to draw is printed to the serial monitor, first with print()
+  and then with the label cache.
+
+  To connect the display to an Arduino:
+  (Arduino pin) = (Display pin)
+  Pin 13 = SCLK on display carrier
+  11 = SDIN
+  10 = !CS
+  9 = !RES
+*/
+
+#include <SSD1320_OLED.h>
+#include <SSD1320_Labels.h>
+
+//Initialize the display with the follow pin connections
+SSD1320 flexibleOLED(10, 9); //10 = CS, 9 = RES
+
+uint8_t labelPool[256]; //Room for the rendered labels
+SSD1320_Labels labels(flexibleOLED, labelPool, sizeof(labelPool));
+
+char temperature[8];
+char rpm[8];
+
+void setup()
+{
+  Serial.begin(115200);
+
+  flexibleOLED.begin(160, 32); //Display is 160 wide, 32 high
+  flexibleOLED.clearDisplay(); //Clear display and buffer
+}
+
+void loop()
+{
+  for (uint8_t useLabels = 0 ; useLabels < 2 ; useLabels++)
+  {
+    unsigned long drawTime = 0;
+
+    for (uint16_t frame = 0 ; frame < 200 ; frame++)
+    {
+      sprintf(temperature, "%d", 20 + frame / 50);
+      sprintf(rpm, "%d", 1000 + (frame / 10) * 50);
+
+      unsigned long start = micros();
+      flexibleOLED.clearDisplay(CLEAR_BUFFER);
+      if (useLabels)
+        drawWithLabels();
+      else
+        drawWithPrint();
+      drawTime += micros() - start;
+
+      flexibleOLED.display();
+    }
+
+    Serial.print(useLabels ? "Labels: " : "print(): ");
+    Serial.print(drawTime / 200);
+    Serial.println("us to draw a frame");
+  }
+}
+
+void drawWithPrint()
+{
+  flexibleOLED.setFontType(0);
+  flexibleOLED.setCursor(0, 22);
+  flexibleOLED.print("TEMP");
+  flexibleOLED.setCursor(80, 22);
+  flexibleOLED.print("RPM");
+  flexibleOLED.setCursor(60, 0);
+  flexibleOLED.print("C");
+
+  flexibleOLED.setFontType(1);
+  flexibleOLED.setCursor(0, 0);
+  flexibleOLED.print(temperature);
+  flexibleOLED.setCursor(80, 0);
+  flexibleOLED.print(rpm);
+}
+
+void drawWithLabels()
+{
+  flexibleOLED.setFontType(0);
+  labels.draw(0, 22, "TEMP");
+  labels.draw(80, 22, "RPM");
+  labels.draw(60, 0, "C");
+
+  flexibleOLED.setFontType(1);
+  labels.draw(0, 0, temperature);
+  labels.draw(80, 0, rpm);
+}
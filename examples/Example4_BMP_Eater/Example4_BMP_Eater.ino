@@ -7,18 +7,19 @@
 
   This example takes in a full BMP file, parses it and displays it on the OLED. This is handy
   because you don't have to convert the BMP into a prog_mem array or anything else.
-  
+  The library's SSD1320_BMP decoder does the work, reading the file as it arrives and
+  writing it to the display one row at a time, so the image never has to fit in RAM.
+
   This is a fun but tricky example.
   1) Use Teraterm or other terminal program capable of sending a binary file.
   2) Connect at 57600bps
-  3) Upload che.bmp, monkey.bmp, or whitebox.bmp
+  3) Upload che.bmp, monkey.bmp, whitebox.bmp, gnome-tooTall.bmp or nyan-tooWide.bmp
   4) Should display on the screen
 
   Requirements:
-  * The BMP should be 160x32 pixels
-  * The BMP should be in grayscale
-  * You can send non-grayscale bitmaps but this program will only display the blue channel
-  * You can send taller or wider bitmaps but it will be displayed incorrectly 
+  * Uncompressed BMP with 1, 4, 8 or 24 bits per pixel, stored bottom-up or top-down
+  * Color images are shown in gray, dithered down to the display's 16 levels
+  * Images bigger than 160x32 are shrunk to fit the display, smaller ones are centered
 
   To connect the display to an Arduino:
   (Arduino pin) = (Display pin)
@@ -34,10 +35,14 @@
 */
 
 #include <SSD1320_OLED.h>
+#include <SSD1320_BMP.h>
 
 //Initialize the display with the follow pin connections
 SSD1320 flexibleOLED(10, 9); //10 = CS, 9 = RES
 
+//Decodes BMPs onto the display
+SSD1320_BMP bmp(flexibleOLED);
+
 void setup()
 {
   Serial.begin(57600);
@@ -48,6 +53,8 @@ void setup()
   flexibleOLED.begin(160, 32); //Display is 160 wide, 32 high
 
   flexibleOLED.clearDisplay(); //Clear display and buffer
+
+  bmp.setDither(DITHER_FLOYD); //Smoother gradients than rounding to the 16 gray levels
 }
 
 void loop()
@@ -57,157 +64,34 @@ void loop()
 
 void getBitmap()
 {
-  /*
-    From: #https://github.com/yy502/ePaperDisplay
-    ### Sample BMP header structure, total = 70 bytes
-    ### !!! little-endian !!!
-
-    Bitmap file header 14 bytes
-    42 4D          "BM"
-    C6 A9 03 00    FileSize = 240,070       <= dynamic value
-    00 00          Reserved
-    00 00          Reserved
-    46 00 00 00    Offset = 70 = 14+56
-
-    DIB header (bitmap information header)
-    BITMAPV3INFOHEADER 56 bytes
-    28 00 00 00    Size = 40
-    20 03 00 00    Width = 800              <= dynamic value
-    58 02 00 00    Height = 600             <= dynamic value
-    01 00          Planes = 1
-    04 00          BitCount = 4
-    00 00 00 00    compression
-    00 00 00 00    SizeImage
-    00 00 00 00    XPerlPerMeter
-    00 00 00 00    YPerlPerMeter
-    04 00 00 00    Colors used = 4
-    00 00 00 00    ColorImportant
-    00 00 00 00    Color definition index 0
-    55 55 55 00    Color definition index 1
-    AA AA AA 00    Color definition index 2
-    FF FF FF 00    Color definition index 3
-  */
-
-  //Begin scanning for incoming bytes
-  Serial.flush(); //Flush anything in RX buffer
   Serial.println();
-  Serial.println("Waiting for 160x32 sized grayscale bitmap to be sent");
+  Serial.println("Waiting for a bitmap to be sent");
   Serial.println("Note: File must be sent in binary");
 
-  //Get BMP header
-  unsigned long fileSize = 0;
-  unsigned long offset = 0;
-  for (int x = 0 ; x < 14 ; x++)
-  {
-    while (Serial.available() == false) delay(1); //Spin and do nothing
-
-    byte incoming = Serial.read();
-
-    //Error check the header bytes
-    if (x == 0)
-    {
-      if (incoming != 'B')
-      {
-        Serial.println("Error: This does not look like a bitmap");
-        while (Serial.available())
-        {
-          Serial.read(); //Wait for sender to stop
-          delay(100);
-        }
-        return;
-      }
-    }
-    if (x == 1)
-    {
-      if (incoming != 'M')
-      {
-        Serial.println("Error: This does not look like a bitmap");
-        while (Serial.available())
-        {
-          Serial.read(); //Wait for sender to stop
-          delay(100);
-        }
-        return;
-      }
-    }
-
-    if (x == 2) fileSize |= ((long)incoming << (8 * 0));
-    if (x == 3) fileSize |= ((long)incoming << (8 * 1));
-    if (x == 4) fileSize |= ((long)incoming << (8 * 2));
-    if (x == 5) fileSize |= ((long)incoming << (8 * 3));
-
-    if (x == 10) offset |= ((long)incoming << (8 * 0));
-    if (x == 11) offset |= ((long)incoming << (8 * 1));
-    if (x == 12) offset |= ((long)incoming << (8 * 2));
-    if (x == 13) offset |= ((long)incoming << (8 * 3));
-  }
+  while (Serial.available() == false) delay(1); //Spin and do nothing
 
-  //Get BMP size and number of colors used
-  unsigned long colorsUsed = 0;
-  for (int x = 0 ; x < 40 ; x++)
-  {
-    while (Serial.available() == false) delay(1); //Spin and do nothing
-
-    byte incoming = Serial.read();
-
-    if (x == 32) colorsUsed |= ((long)incoming << (8 * 0));
-    if (x == 33) colorsUsed |= ((long)incoming << (8 * 1));
-    if (x == 34) colorsUsed |= ((long)incoming << (8 * 2));
-    if (x == 35) colorsUsed |= ((long)incoming << (8 * 3));
-  }
-
-  //Get look-up-table of colors
-  byte colorTable[colorsUsed]; //Create array big enough to handle # of colors
-  for (int x = 0 ; x < colorsUsed ; x++)
-  {
-    //Each color record is 4 bytes but we only need the first
-    for (int j = 0 ; j < 4 ; j++)
-    {
-      while (Serial.available() == false) delay(1); //Spin and do nothing
-      byte incoming = Serial.read();
-
-      if (j == 0) colorTable[x] = incoming;
-    }
-  }
+  flexibleOLED.clearDisplay(CLEAR_DISPLAY); //Blank what a smaller image won't cover
 
-  //Make sure the display is ready to go
-  flexibleOLED.setRowAddress(0);
-  flexibleOLED.setColumnAddress(0);
+  //Wait up to a second for each byte. A file that stops part way times out.
+  Serial.setTimeout(1000);
+  byte result = bmp.drawFitted(Serial);
 
-  //Next we have pixel data. Using the look-up-table
-  //convert the pixel's color code to the actual color,
-  //then down sample each 8-bit byte to a 4-bit,
-  //then combine two bytes at a time into one byte
-  //then send to the display
-  for (unsigned long i = 0 ; i < fileSize - offset - 1 ; i += 2)
+  if (result == BMP_NOT_BMP)
+    Serial.println("Error: This does not look like a bitmap");
+  else if (result == BMP_UNSUPPORTED)
+    Serial.println("Error: Only uncompressed 1, 4, 8 and 24 bit bitmaps are supported");
+  else if (result == BMP_TIMEOUT)
+    Serial.println("Error: The file stopped part way through");
+  else
   {
-    //Get the two bytes
-    while (Serial.available() == false) delay(1); //Spin and do nothing
-    byte byte1 = Serial.read();
-
-    while (Serial.available() == false) delay(1); //Spin and do nothing
-    byte byte2 = Serial.read();
-
-    //Covert color code to actual color
-    byte1 = colorTable[byte1];
-    byte2 = colorTable[byte2];
-
-    //Covert 8-bit value to 4 bit by removing lower 4 bits
-    byte2 &= 0xF0;
-    byte1 >>= 4;
-
-    byte combined = byte1 | byte2; //Combine two bytes into one
-
-    flexibleOLED.data(combined); //Write byte directly to display
+    Serial.print("width: ");
+    Serial.println(bmp.getWidth());
+    Serial.print("height: ");
+    Serial.println(bmp.getHeight());
+    Serial.print("bits per pixel: ");
+    Serial.println(bmp.getBitsPerPixel());
   }
 
-  Serial.print("fileSize: ");
-  Serial.println(fileSize);
-  Serial.print("offset: ");
-  Serial.println(offset);
-  Serial.print("colorsUsed: ");
-  Serial.println(colorsUsed);
-
   while (Serial.available())
   {
     delay(10);
@@ -216,7 +100,3 @@ void getBitmap()
 
   Serial.println("All done!");
 }
-
-
-
-
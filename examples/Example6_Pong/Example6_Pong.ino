@@ -8,7 +8,9 @@
   A silly pong example. Comes from Marshall's tutorial:
   https://learn.sparkfun.com/tutorials/teensyview-hookup-guide#example-prop-shield-compatible-connection
 
-  On an 8MHz Arduino Pro Mini this is pretty painfully slow. 
+  The field is drawn once. The ball and paddles are sprites (see SSD1320_Sprites.h), so
+  each frame only sends the few pixels around them that changed instead of the whole
+  display: tens of bytes a frame rather than thousands.
 
   To connect the display to an Arduino:
   (Arduino pin) = (Display pin)
@@ -24,17 +26,41 @@
 */
 
 #include <SSD1320_OLED.h>
+#include <SSD1320_Sprites.h>
 
 //Initialize the display with the follow pin connections
 //Note that you should not change SCLK and MOSI because the 
 //library uses hardware SPI
 SSD1320 flexibleOLED(10, 9, 13, 11); //CS, RES, SCLK, MOSI(SDIN on OLED board)
+SSD1320_Sprites sprites(flexibleOLED);
+
+//Sprite images: format, width, height, then rows from the bottom up
+const uint8_t ballImage[] PROGMEM = {
+  IMAGE_1BPP, 5, 5,
+  0x70, //.###.
+  0x88, //#...#
+  0x88, //#...#
+  0x88, //#...#
+  0x70, //.###.
+};
+
+const uint8_t paddleImage[] PROGMEM = {
+  IMAGE_1BPP, 3, 15,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+};
+
+int8_t ball, paddle0, paddle1;
 
 void setup()
 {
   Serial.begin(115200);
 
   flexibleOLED.begin(160, 32); //Display is 160 wide, 32 high
+
+  //The ball goes over the paddles
+  paddle0 = sprites.add(paddleImage, 0, 0);
+  paddle1 = sprites.add(paddleImage, 0, 0);
+  ball = sprites.add(ballImage, 0, 0, 1);
 }
 
 void loop()
@@ -64,6 +90,17 @@ void shapeExample()
   int paddle0Velocity = -1;  // Paddle 0 velocity
   int paddle1Velocity = 1;  // Paddle 1 velocity
 
+  // Draw the Pong Field once. Only the sprites change from here on.
+  // Draw an outline of the screen:
+  flexibleOLED.rect(0, 0, flexibleOLED.getDisplayWidth() - 1, flexibleOLED.getDisplayHeight());
+  // Draw the center line
+  flexibleOLED.rectFill(flexibleOLED.getDisplayWidth() / 2 - 1, 0, 2, flexibleOLED.getDisplayHeight());
+  // Place the sprites and send everything
+  sprites.moveTo(paddle0, paddle0_X, paddle0_Y);
+  sprites.moveTo(paddle1, paddle1_X, paddle1_Y);
+  sprites.moveTo(ball, ball_X - ball_rad, ball_Y - ball_rad);
+  sprites.redraw();
+
   //while(ball_X >= paddle0_X + paddleW - 1)
   while ((ball_X - ball_rad > 1) &&
          (ball_X + ball_rad < flexibleOLED.getDisplayWidth() - 2))
@@ -111,23 +148,15 @@ void shapeExample()
       paddle1Velocity = -paddle1Velocity;
     }
 
-    // Draw the Pong Field
-    flexibleOLED.clearDisplay(CLEAR_BUFFER); //Save time. Only clear the local buffer.
-    // Draw an outline of the screen:
-    flexibleOLED.rect(0, 0, flexibleOLED.getDisplayWidth() - 1, flexibleOLED.getDisplayHeight());
-    // Draw the center line
-    flexibleOLED.rectFill(flexibleOLED.getDisplayWidth() / 2 - 1, 0, 2, flexibleOLED.getDisplayHeight());
-    // Draw the Paddles:
-    flexibleOLED.rectFill(paddle0_X, paddle0_Y, paddleW, paddleH);
-    flexibleOLED.rectFill(paddle1_X, paddle1_Y, paddleW, paddleH);
-    // Draw the ball:
-    flexibleOLED.circle(ball_X, ball_Y, ball_rad);
-    // Actually draw everything on the screen:
-    flexibleOLED.display();
+    // Move the sprites. flush() sends only what changed.
+    sprites.moveTo(paddle0, paddle0_X, paddle0_Y);
+    sprites.moveTo(paddle1, paddle1_X, paddle1_Y);
+    sprites.moveTo(ball, ball_X - ball_rad, ball_Y - ball_rad);
+    sprites.flush();
 
     //delay(25);  // Delay for visibility
   }
-  
+
   delay(1000);
 }
 
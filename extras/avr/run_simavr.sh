@@ -0,0 +1,15 @@
+#!/bin/sh
+# Build Example10_CycleBenchmark for AVR and run it in simavr. See README.md.
+set -e
+
+FQBN=${FQBN:-arduino:avr:pro:cpu=8MHzatmega328}
+F_CPU=${F_CPU:-8000000}
+MCU=${MCU:-atmega328p}
+
+LIBRARY=$(cd "$(dirname "$0")/../.." && pwd)
+BUILD=${BUILD:-$LIBRARY/_avr_build}
+
+arduino-cli compile --fqbn "$FQBN" --library "$LIBRARY" --output-dir "$BUILD" \
+  "$LIBRARY/examples/Example10_CycleBenchmark"
+
+simavr -m "$MCU" -f "$F_CPU" "$BUILD/Example10_CycleBenchmark.ino.elf"
@@ -0,0 +1,138 @@
+/*
+  Host shim for building the SSD1320 library on Linux. See Arduino.h.
+*/
+
+#include "Arduino.h"
+#include "SPI.h"
+#include "Wire.h"
+
+#include <chrono>
+#include <vector>
+#include <algorithm>
+
+HostSerial Serial;
+SPIClass SPI;
+TwoWire Wire;
+
+static std::vector<HostBusListener *> listeners;
+static uint8_t pinLevel[256];
+static unsigned long long skippedMicros = 0;
+
+void hostAttach(HostBusListener *listener) {
+  listeners.push_back(listener);
+}
+
+void hostDetach(HostBusListener *listener) {
+  listeners.erase(std::remove(listeners.begin(), listeners.end(), listener), listeners.end());
+}
+
+void hostNotifySpiBegin(uint32_t clock) {
+  for (size_t i = 0 ; i < listeners.size() ; i++) listeners[i]->spiBeginTransaction(clock);
+}
+
+void hostNotifySpiTransfer(uint8_t data) {
+  for (size_t i = 0 ; i < listeners.size() ; i++) listeners[i]->spiTransfer(data);
+}
+
+void hostNotifyI2cWrite(uint8_t address, const uint8_t *data, uint8_t length, uint32_t clock) {
+  for (size_t i = 0 ; i < listeners.size() ; i++) listeners[i]->i2cWrite(address, data, length, clock);
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  (void)pin;
+  (void)mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+  pinLevel[pin] = value ? HIGH : LOW;
+  for (size_t i = 0 ; i < listeners.size() ; i++) listeners[i]->pinWrite(pin, pinLevel[pin]);
+}
+
+int digitalRead(uint8_t pin) {
+  return pinLevel[pin];
+}
+
+static unsigned long long realMicros(void) {
+  static std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+void delay(unsigned long ms) {
+  skippedMicros += (unsigned long long)ms * 1000;
+}
+
+void delayMicroseconds(unsigned int us) {
+  skippedMicros += us;
+}
+
+unsigned long micros(void) {
+  return (unsigned long)(realMicros() + skippedMicros);
+}
+
+unsigned long millis(void) {
+  return (unsigned long)((realMicros() + skippedMicros) / 1000);
+}
+
+void randomSeed(unsigned long seed) {
+  srand(seed);
+}
+
+long random(long howbig) {
+  if (howbig <= 0) return 0;
+  return rand() % howbig;
+}
+
+long random(long howsmall, long howbig) {
+  if (howsmall >= howbig) return howsmall;
+  return howsmall + random(howbig - howsmall);
+}
+
+size_t Print::write(const uint8_t *buffer, size_t size) {
+  size_t n = 0;
+  while (size--) n += write(*buffer++);
+  return n;
+}
+
+size_t Print::print(long n, int base) {
+  if (n < 0 && base == DEC) return print('-') + print((unsigned long)-n, base);
+  return print((unsigned long)n, base);
+}
+
+size_t Print::print(unsigned long n, int base) {
+  char buf[8 * sizeof(long) + 1];
+  char *str = &buf[sizeof(buf) - 1];
+  *str = '\0';
+  if (base < 2) base = 10;
+  do {
+    unsigned long digit = n % base;
+    n /= base;
+    *--str = digit < 10 ? '0' + digit : 'A' + digit - 10;
+  } while (n);
+  return write(str);
+}
+
+size_t Print::print(double n, int digits) {
+  char buf[48];
+  snprintf(buf, sizeof(buf), "%.*f", digits, n);
+  return write(buf);
+}
+
+int Stream::timedRead() {
+  unsigned long start = millis();
+  do {
+    int c = read();
+    if (c >= 0) return c;
+  } while (millis() - start < _timeout);
+  return -1;
+}
+
+size_t Stream::readBytes(uint8_t *buffer, size_t length) {
+  size_t count = 0;
+  while (count < length) {
+    int c = timedRead();
+    if (c < 0) break;
+    *buffer++ = (uint8_t)c;
+    count++;
+  }
+  return count;
+}
@@ -0,0 +1,129 @@
+/*
+  Host shim for building the SSD1320 library on Linux.
+
+  Provides just enough of the Arduino core to compile the library and the benchmark
+  programs with a desktop compiler. Pin writes and SPI bytes are handed to any attached
+  HostBusListener, which is how VirtualSSD1320 sees the 9-bit SPI stream.
+
+  Time is virtual: millis() and micros() follow the real clock, but delay() and
+  delayMicroseconds() return at once and move the clock forward instead of sleeping.
+*/
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define HIGH 1
+#define LOW 0
+
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+
+#define LSBFIRST 0
+#define MSBFIRST 1
+
+#define DEC 10
+#define HEX 16
+#define BIN 2
+
+#define PROGMEM
+#define PSTR(s) (s)
+#define F(s) (s)
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define pgm_read_ptr(addr) (*(void * const *)(addr))
+#define memcpy_P(dest, src, n) memcpy((dest), (src), (n))
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+unsigned long millis(void);
+unsigned long micros(void);
+
+void randomSeed(unsigned long seed);
+long random(long howbig);
+long random(long howsmall, long howbig);
+
+// Anything that wants to watch the pins and the SPI bus.
+class HostBusListener {
+  public:
+    virtual ~HostBusListener() {}
+    virtual void pinWrite(uint8_t /*pin*/, uint8_t /*value*/) {}
+    virtual void spiBeginTransaction(uint32_t /*clock*/) {}
+    virtual void spiTransfer(uint8_t /*data*/) {}
+    virtual void i2cWrite(uint8_t /*address*/, const uint8_t * /*data*/, uint8_t /*length*/, uint32_t /*clock*/) {}
+};
+
+void hostAttach(HostBusListener *listener);
+void hostDetach(HostBusListener *listener);
+void hostNotifySpiBegin(uint32_t clock);
+void hostNotifySpiTransfer(uint8_t data);
+void hostNotifyI2cWrite(uint8_t address, const uint8_t *data, uint8_t length, uint32_t clock);
+
+class Print {
+  public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size);
+    size_t write(const char *str) { return write((const uint8_t *)str, strlen(str)); }
+
+    size_t print(const char *str) { return write(str); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int n, int base = DEC) { return print((long)n, base); }
+    size_t print(unsigned int n, int base = DEC) { return print((unsigned long)n, base); }
+    size_t print(long n, int base = DEC);
+    size_t print(unsigned long n, int base = DEC);
+    size_t print(double n, int digits = 2);
+
+    size_t println(void) { return write("\r\n"); }
+    template <typename T> size_t println(T value) { size_t n = print(value); return n + println(); }
+    template <typename T> size_t println(T value, int format) { size_t n = print(value, format); return n + println(); }
+};
+
+class Stream : public Print {
+  public:
+    Stream() : _timeout(1000) {}
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    virtual void flush() {}
+
+    void setTimeout(unsigned long timeout) { _timeout = timeout; }
+    size_t readBytes(uint8_t *buffer, size_t length);
+    size_t readBytes(char *buffer, size_t length) { return readBytes((uint8_t *)buffer, length); }
+
+  protected:
+    unsigned long _timeout;
+    int timedRead();
+};
+
+// Serial goes to stdout. Nothing is ever received.
+class HostSerial : public Stream {
+  public:
+    void begin(unsigned long) {}
+    int available() { return 0; }
+    int read() { return -1; }
+    int peek() { return -1; }
+    void flush() { fflush(stdout); }
+    size_t write(uint8_t c) { return fputc(c, stdout) == EOF ? 0 : 1; }
+    using Print::write;
+    operator bool() { return true; }
+};
+
+extern HostSerial Serial;
+
+#endif
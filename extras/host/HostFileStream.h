@@ -0,0 +1,55 @@
+/*
+  A Stream that reads a file, so a sketch's Stream code (a BMP decoder, an image player)
+  can be fed from disk on the host. Writes go nowhere.
+*/
+
+#ifndef HOST_FILE_STREAM_H
+#define HOST_FILE_STREAM_H
+
+#include "Arduino.h"
+
+class HostFileStream : public Stream {
+  public:
+    HostFileStream(const char *path) : bytesRead(0), _peeked(-1) { _file = fopen(path, "rb"); }
+    ~HostFileStream() { if (_file != NULL) fclose(_file); }
+
+    bool isOpen(void) { return _file != NULL; }
+
+    int available() {
+      if (_file == NULL) return 0;
+      if (_peeked >= 0) return 1;
+      long here = ftell(_file);
+      fseek(_file, 0, SEEK_END);
+      long end = ftell(_file);
+      fseek(_file, here, SEEK_SET);
+      return (int)(end - here);
+    }
+
+    int read() {
+      int c = peek();
+      if (c >= 0) {
+        _peeked = -1;
+        bytesRead++;
+      }
+      return c;
+    }
+
+    int peek() {
+      if (_peeked < 0 && _file != NULL) {
+        int c = fgetc(_file);
+        if (c != EOF) _peeked = c;
+      }
+      return _peeked;
+    }
+
+    size_t write(uint8_t) { return 0; }
+    using Print::write;
+
+    unsigned long bytesRead;
+
+  private:
+    FILE *_file;
+    int _peeked;
+};
+
+#endif
@@ -0,0 +1,44 @@
+/*
+  A Stream that reads a byte array, so Stream code can be fed from data built in memory.
+  Set limit to make the stream run dry early, like a file or link that was cut short.
+  Writes go nowhere.
+*/
+
+#ifndef HOST_MEMORY_STREAM_H
+#define HOST_MEMORY_STREAM_H
+
+#include "Arduino.h"
+
+class HostMemoryStream : public Stream {
+  public:
+    HostMemoryStream(const uint8_t *data, size_t length) : bytesRead(0), limit(length), _data(data), _length(length) {}
+
+    void rewind(void) { bytesRead = 0; }
+
+    int available() {
+      size_t end = (limit < _length) ? limit : _length;
+      return (bytesRead < end) ? (int)(end - bytesRead) : 0;
+    }
+
+    int read() {
+      int c = peek();
+      if (c >= 0) bytesRead++;
+      return c;
+    }
+
+    int peek() {
+      return available() ? _data[bytesRead] : -1;
+    }
+
+    size_t write(uint8_t) { return 0; }
+    using Print::write;
+
+    size_t bytesRead;
+    size_t limit;
+
+  private:
+    const uint8_t *_data;
+    size_t _length;
+};
+
+#endif
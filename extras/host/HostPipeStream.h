@@ -0,0 +1,58 @@
+/*
+  A Stream over a pair of Unix file descriptors, usually the ends of pipes, so a sketch's
+  Stream code can talk to another part of the same host program or to another process.
+  Reads never block: available() says what is waiting.
+*/
+
+#ifndef HOST_PIPE_STREAM_H
+#define HOST_PIPE_STREAM_H
+
+#include "Arduino.h"
+
+#include <unistd.h>
+#include <sys/ioctl.h>
+
+class HostPipeStream : public Stream {
+  public:
+    HostPipeStream(int readFd, int writeFd) : bytesRead(0), bytesWritten(0), _readFd(readFd), _writeFd(writeFd), _peeked(-1) {}
+
+    int available() {
+      int waiting = 0;
+      if (ioctl(_readFd, FIONREAD, &waiting) < 0) waiting = 0;
+      return waiting + (_peeked >= 0 ? 1 : 0);
+    }
+
+    int read() {
+      int c = peek();
+      if (c >= 0) {
+        _peeked = -1;
+        bytesRead++;
+      }
+      return c;
+    }
+
+    int peek() {
+      if (_peeked < 0) {
+        uint8_t c;
+        int waiting = 0;
+        if (ioctl(_readFd, FIONREAD, &waiting) < 0 || waiting == 0) return -1;
+        if (::read(_readFd, &c, 1) == 1) _peeked = c;
+      }
+      return _peeked;
+    }
+
+    size_t write(uint8_t c) {
+      if (::write(_writeFd, &c, 1) != 1) return 0;
+      bytesWritten++;
+      return 1;
+    }
+    using Print::write;
+
+    unsigned long bytesRead, bytesWritten;
+
+  private:
+    int _readFd, _writeFd;
+    int _peeked;
+};
+
+#endif
@@ -0,0 +1,47 @@
+/*
+  Host shim for the Arduino SPI library. Every byte sent is passed to the attached
+  HostBusListeners. Nothing is ever received, transfer() returns 0xFF.
+*/
+
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+#include "Arduino.h"
+
+#define SPI_MODE0 0x00
+#define SPI_MODE1 0x04
+#define SPI_MODE2 0x08
+#define SPI_MODE3 0x0C
+
+class SPISettings {
+  public:
+    SPISettings(uint32_t clock = 4000000, uint8_t bitOrder = MSBFIRST, uint8_t dataMode = SPI_MODE0)
+      : _clock(clock), _bitOrder(bitOrder), _dataMode(dataMode) {}
+    uint32_t _clock;
+    uint8_t _bitOrder, _dataMode;
+};
+
+class SPIClass {
+  public:
+    void begin(void) {}
+    void end(void) {}
+    void beginTransaction(SPISettings settings) { hostNotifySpiBegin(settings._clock); }
+    void endTransaction(void) {}
+
+    uint8_t transfer(uint8_t data) {
+      hostNotifySpiTransfer(data);
+      return 0xFF;
+    }
+    void transfer(void *buffer, size_t count) {
+      uint8_t *spot = (uint8_t *)buffer;
+      while (count--)
+      {
+        *spot = transfer(*spot);
+        spot++;
+      }
+    }
+};
+
+extern SPIClass SPI;
+
+#endif
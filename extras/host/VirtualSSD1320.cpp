@@ -0,0 +1,375 @@
+/*
+  Virtual SSD1320 for host builds. See VirtualSSD1320.h.
+*/
+
+#include "VirtualSSD1320.h"
+
+// Frames between scroll steps for each interval code, from the SSD1306 family
+static const uint16_t scrollIntervalFrames[8] = {5, 64, 128, 256, 3, 4, 25, 2};
+
+// Number of parameter bytes that follow each command
+static uint8_t commandArguments(uint8_t c, bool &known) {
+  known = true;
+  switch (c) {
+    case 0x20: case 0x25: case 0x81: case 0x8D: case 0xA2: case 0xA8: case 0xAC: case 0xAD:
+    case 0xBC: case 0xD3: case 0xD5: case 0xD9: case 0xDA: case 0xDB: case 0xFD:
+      return 1;
+    case 0x21: case 0x22: case 0xA3:
+      return 2;
+    case 0x29: case 0x2A:
+      return 5;
+    case 0x26: case 0x27:
+      return 6;
+    case 0xBE:
+      return 15;
+    case 0x2E: case 0x2F: case 0xA0: case 0xA1: case 0xA4: case 0xA5: case 0xA6: case 0xA7:
+    case 0xAE: case 0xAF: case 0xBF: case 0xC0: case 0xC8: case 0xE3:
+      return 0;
+  }
+  known = false;
+  return 0;
+}
+
+VirtualSSD1320::VirtualSSD1320(uint8_t csPin, uint8_t rstPin, uint8_t sclkPin, uint8_t sdoutPin, uint8_t dcPin) {
+  _cs = csPin;
+  _rst = rstPin;
+  _sclk = sclkPin;
+  _sd = sdoutPin;
+  _dc = dcPin;
+  _i2cAddress = 0xFF; // Not on the I2C bus
+  spiClock = 0;
+  maxClock = 0;
+
+  _csLevel = HIGH;
+  _sclkLevel = LOW;
+  _sdLevel = LOW;
+  _rstLevel = HIGH;
+  _dcLevel = LOW;
+
+  memset(gdram, 0, sizeof(gdram));
+  reset();
+  clearCounters();
+
+  hostAttach(this);
+}
+
+VirtualSSD1320::~VirtualSSD1320() {
+  hostDetach(this);
+}
+
+// Listen to Wire transmissions to address instead of the SPI bus
+void VirtualSSD1320::useI2C(uint8_t address) {
+  _i2cAddress = address;
+}
+
+// Power on reset values. GDRAM is left alone.
+void VirtualSSD1320::reset(void) {
+  columnStart = 0;
+  columnEnd = VIRTUAL_GDRAM_COLUMNS - 1;
+  rowStart = 0;
+  rowEnd = VIRTUAL_GDRAM_ROWS - 1;
+  column = 0;
+  row = 0;
+  startLine = 0;
+  displayOffset = 0;
+  multiplex = VIRTUAL_GDRAM_ROWS - 1;
+  contrast = 0x7F;
+  segmentRemap = false;
+  comScanDecrement = false;
+  displayOn = false;
+  allOn = false;
+  inverted = false;
+  for (uint8_t x = 0 ; x < 15 ; x++) grayTable[x] = (x + 1) * 2;
+  customGrayTable = false;
+  scrolling = false;
+  scrollCommand = 0;
+  scrollLine = 0;
+  _scrollFrames = 0;
+
+  _shift = 0;
+  _bitCount = 0;
+  _argCount = 0;
+  _argsNeeded = 0;
+}
+
+void VirtualSSD1320::clearCounters(void) {
+  memset(&counters, 0, sizeof(counters));
+}
+
+void VirtualSSD1320::pinWrite(uint8_t pin, uint8_t value) {
+  if (pin != _cs && pin != _rst && pin != _sclk && pin != _sd && pin != _dc) return;
+
+  counters.pinWrites++;
+
+  if (pin == _cs) {
+    if (value != _csLevel) {
+      counters.pinToggles++;
+      counters.csToggles++;
+    }
+    _csLevel = value;
+    if (_csLevel == HIGH) _bitCount = 0; // CS high throws away a partial word
+  }
+  else if (pin == _dc) {
+    if (value != _dcLevel) counters.pinToggles++;
+    _dcLevel = value;
+  }
+  else if (pin == _sclk) {
+    if (value != _sclkLevel) counters.pinToggles++;
+    if (value == HIGH && _sclkLevel == LOW && _csLevel == LOW) {
+      counters.bangedBits++;
+      shiftBit(_sdLevel);
+    }
+    _sclkLevel = value;
+  }
+  else if (pin == _sd) {
+    if (value != _sdLevel) counters.pinToggles++;
+    _sdLevel = value;
+  }
+  else if (pin == _rst) {
+    if (value != _rstLevel) counters.pinToggles++;
+    if (value == LOW && _rstLevel == HIGH) {
+      counters.resets++;
+      reset();
+    }
+    _rstLevel = value;
+  }
+}
+
+void VirtualSSD1320::spiBeginTransaction(uint32_t clock) {
+  spiClock = clock;
+  counters.spiTransactions++;
+}
+
+void VirtualSSD1320::spiTransfer(uint8_t data) {
+  if (_csLevel != LOW) return; // Not for us
+
+  counters.spiBytes++;
+  if (maxClock && spiClock > maxClock) {
+    // Too fast for the wiring, one bit in each byte comes through wrong
+    counters.corruptedBytes++;
+    data ^= 1 << (counters.spiBytes % 8);
+  }
+
+  if (_dc != VIRTUAL_NO_PIN) {
+    word((_dcLevel ? 0x100 : 0) | data);
+    return;
+  }
+
+  for (int8_t bit = 7 ; bit >= 0 ; bit--)
+    shiftBit((data >> bit) & 0x01);
+
+  // Hardware SPI leaves SCLK low (mode 0) and SDIN on the last bit
+  _sdLevel = data & 0x01;
+}
+
+void VirtualSSD1320::i2cWrite(uint8_t address, const uint8_t *data, uint8_t length, uint32_t clock) {
+  (void)clock;
+  if (address != _i2cAddress) return;
+
+  counters.i2cTransmissions++;
+  counters.i2cBytes += length;
+  if (length < 2) counters.framingErrors++; // A control byte and nothing to go with it
+
+  uint8_t spot = 0;
+  while (spot < length) {
+    uint8_t control = data[spot++];
+    counters.controlBytes++;
+    if (control & 0x3F) counters.framingErrors++; // Only Co and D/C# may be set
+
+    uint16_t dc = (control & 0x40) ? 0x100 : 0;
+    if (control & 0x80) { // Co = 1: one byte, then another control byte
+      if (spot < length) word(dc | data[spot++]);
+      else counters.framingErrors++;
+    }
+    else { // Co = 0: the rest of the transmission
+      while (spot < length) word(dc | data[spot++]);
+    }
+  }
+}
+
+void VirtualSSD1320::shiftBit(uint8_t bit) {
+  _shift = (_shift << 1) | (bit ? 1 : 0);
+  if (++_bitCount == 9) {
+    _bitCount = 0;
+    word(_shift & 0x1FF);
+  }
+}
+
+void VirtualSSD1320::word(uint16_t w) {
+  if (w & 0x100) {
+    counters.dataBytes++;
+    dataByte(w & 0xFF);
+  }
+  else {
+    counters.commandBytes++;
+    commandByte(w & 0xFF);
+  }
+}
+
+void VirtualSSD1320::commandByte(uint8_t c) {
+  if (_argsNeeded) {
+    _args[_argCount++] = c;
+    if (_argCount == _argsNeeded) {
+      _argsNeeded = 0;
+      executeCommand();
+    }
+    return;
+  }
+
+  bool known;
+  _command = c;
+  _argCount = 0;
+  _argsNeeded = commandArguments(c, known);
+  if (!known) counters.unknownCommands++;
+  if (c == 0xE3) counters.nops++;
+  if (_argsNeeded == 0) executeCommand();
+}
+
+void VirtualSSD1320::executeCommand(void) {
+  switch (_command) {
+    case 0x21:
+      columnStart = _args[0] % VIRTUAL_GDRAM_COLUMNS;
+      columnEnd = _args[1] % VIRTUAL_GDRAM_COLUMNS;
+      column = columnStart;
+      break;
+    case 0x22:
+      rowStart = _args[0] % VIRTUAL_GDRAM_ROWS;
+      rowEnd = _args[1] % VIRTUAL_GDRAM_ROWS;
+      row = rowStart;
+      break;
+    case 0x26: case 0x27: case 0x29: case 0x2A:
+      scrollCommand = _command;
+      memcpy(scrollArgs, _args, 6);
+      break;
+    case 0x2E:
+      scrolling = false;
+      scrollLine = 0;
+      break;
+    case 0x2F:
+      if (scrollCommand) {
+        scrolling = true;
+        _scrollFrames = 0;
+      }
+      break;
+    case 0x81: contrast = _args[0]; break;
+    case 0xA0: segmentRemap = false; break;
+    case 0xA1: segmentRemap = true; break;
+    case 0xA2: startLine = _args[0] % VIRTUAL_GDRAM_ROWS; break;
+    case 0xA4: allOn = false; break;
+    case 0xA5: allOn = true; break;
+    case 0xA6: inverted = false; break;
+    case 0xA7: inverted = true; break;
+    case 0xA8: multiplex = (_args[0] < VIRTUAL_GDRAM_ROWS) ? _args[0] : VIRTUAL_GDRAM_ROWS - 1; break;
+    case 0xAE: displayOn = false; break;
+    case 0xAF: displayOn = true; break;
+    case 0xBE:
+      memcpy(grayTable, _args, 15);
+      customGrayTable = true;
+      break;
+    case 0xBF:
+      for (uint8_t x = 0 ; x < 15 ; x++) grayTable[x] = (x + 1) * 2;
+      customGrayTable = false;
+      break;
+    case 0xC0: comScanDecrement = false; break;
+    case 0xC8: comScanDecrement = true; break;
+    case 0xD3: displayOffset = _args[0] % VIRTUAL_GDRAM_ROWS; break;
+  }
+}
+
+// Horizontal addressing: step along the column window, wrap to the next row in the row window
+void VirtualSSD1320::dataByte(uint8_t d) {
+  gdram[row][column] = d;
+
+  if (column == columnEnd) {
+    column = columnStart;
+    row = (row == rowEnd) ? rowStart : (row + 1) % VIRTUAL_GDRAM_ROWS;
+  }
+  else
+    column = (column + 1) % VIRTUAL_GDRAM_COLUMNS;
+}
+
+// The low nibble is the left pixel of each column byte
+uint8_t VirtualSSD1320::gdramPixel(uint16_t x, uint16_t y) {
+  uint8_t thing = gdram[y % VIRTUAL_GDRAM_ROWS][(x / 2) % VIRTUAL_GDRAM_COLUMNS];
+  return (x & 1) ? (thing >> 4) : (thing & 0x0F);
+}
+
+// Gray level (0 to 15) of a pixel as seen on the panel, y = 0 is the top row.
+// The flexible panel is mounted so that with COMSCANINC the first GDRAM row is at the bottom.
+uint8_t VirtualSSD1320::pixel(uint16_t x, uint16_t y) {
+  if (!displayOn) return 0;
+  if (allOn) return 15;
+
+  uint16_t line = comScanDecrement ? y : multiplex - y;
+  uint16_t gdramRow = (line + startLine + scrollLine + displayOffset + VIRTUAL_GDRAM_ROWS - VIRTUAL_PANEL_OFFSET) % VIRTUAL_GDRAM_ROWS;
+  uint16_t gdramColumn = segmentRemap ? VIRTUAL_PANEL_WIDTH - 1 - x : x;
+
+  uint8_t level = gdramPixel(gdramColumn, gdramRow);
+  return inverted ? 15 - level : level;
+}
+
+// FNV-1a over the visible image, handy for golden checks
+uint32_t VirtualSSD1320::frameChecksum(void) {
+  uint32_t hash = 2166136261UL;
+  for (uint16_t y = 0 ; y < height() ; y++)
+    for (uint16_t x = 0 ; x < width() ; x++)
+      hash = (hash ^ pixel(x, y)) * 16777619UL;
+  return hash;
+}
+
+bool VirtualSSD1320::dumpPGM(const char *path) {
+  FILE *file = fopen(path, "wb");
+  if (file == NULL) return false;
+
+  fprintf(file, "P5\n%u %u\n255\n", width(), height());
+  for (uint16_t y = 0 ; y < height() ; y++)
+    for (uint16_t x = 0 ; x < width() ; x++)
+      fputc(pixel(x, y) * 17, file);
+
+  fclose(file);
+  return true;
+}
+
+void VirtualSSD1320::advanceFrames(uint16_t frames) {
+  if (!scrolling) return;
+
+  uint16_t interval = scrollIntervalFrames[scrollArgs[2] & 0x07];
+  _scrollFrames += frames;
+  while (_scrollFrames >= interval) {
+    _scrollFrames -= interval;
+    scrollStep();
+  }
+}
+
+// One scroll step. Horizontal scrolling really moves the GDRAM, the vertical part
+// only moves the start line.
+void VirtualSSD1320::scrollStep(void) {
+  bool left = (scrollCommand == 0x27 || scrollCommand == 0x2A);
+  uint8_t firstRow = scrollArgs[1];
+  uint8_t lastRow = scrollArgs[3];
+  uint8_t firstColumn = 0;
+  uint8_t lastColumn = VIRTUAL_GDRAM_COLUMNS - 1;
+
+  if (scrollCommand == 0x26 || scrollCommand == 0x27) {
+    firstColumn = scrollArgs[4];
+    lastColumn = (scrollArgs[5] < VIRTUAL_GDRAM_COLUMNS) ? scrollArgs[5] : VIRTUAL_GDRAM_COLUMNS - 1;
+  }
+  else
+    scrollLine = (scrollLine + scrollArgs[4]) % (multiplex + 1);
+
+  if (lastColumn <= firstColumn) return;
+
+  for (uint16_t r = firstRow ; r <= lastRow && r < VIRTUAL_GDRAM_ROWS ; r++) {
+    uint8_t *line = gdram[r];
+    if (left) {
+      uint8_t first = line[firstColumn];
+      memmove(&line[firstColumn], &line[firstColumn + 1], lastColumn - firstColumn);
+      line[lastColumn] = first;
+    }
+    else {
+      uint8_t last = line[lastColumn];
+      memmove(&line[firstColumn + 1], &line[firstColumn], lastColumn - firstColumn);
+      line[firstColumn] = last;
+    }
+  }
+}
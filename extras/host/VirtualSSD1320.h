@@ -0,0 +1,110 @@
+/*
+  Virtual SSD1320 for host builds.
+
+  Watches the CS, SCLK and SDIN pins plus the SPI bus through the host shim and
+  decodes the 3-wire 9-bit stream the same way the controller does: one D/C# bit
+  then eight data bits, MSB first, with the bit counter cleared whenever CS goes high.
+  Give it a D/C# pin and it decodes 4-wire SPI instead: plain 8-bit bytes, with D/C#
+  read from that pin. After useI2C() it decodes Wire transmissions to its address instead:
+  control bytes (Co and D/C# bits) followed by commands or data.
+  Commands drive a model of the controller (address window, remap, start line, offset,
+  multiplex, invert, gray table, scrolling) and data bytes land in a 160x160 4-bit GDRAM.
+
+  Every pin write, SPI byte and decoded word is counted so a change can be checked for
+  both correctness (dumpPGM(), pixel()) and bus cost (counters).
+*/
+
+#ifndef VIRTUAL_SSD1320_H
+#define VIRTUAL_SSD1320_H
+
+#include "Arduino.h"
+
+#define VIRTUAL_GDRAM_COLUMNS 80   // Each column byte holds two pixels
+#define VIRTUAL_GDRAM_ROWS    160
+#define VIRTUAL_PANEL_WIDTH   160
+#define VIRTUAL_PANEL_OFFSET  0x60 // Display offset the flexible panel is wired for
+#define VIRTUAL_NO_PIN        0xFF // No D/C# pin, 3-wire mode
+
+struct VirtualSSD1320Counters {
+  unsigned long pinWrites;     // Every digitalWrite() on the watched pins
+  unsigned long pinToggles;    // digitalWrite() calls that changed a pin level
+  unsigned long csToggles;     // CS level changes
+  unsigned long bangedBits;    // Bits clocked in by bit banging SCLK
+  unsigned long spiBytes;      // Bytes sent through the SPI hardware while CS was low
+  unsigned long spiTransactions;
+  unsigned long commandBytes;  // Decoded words with D/C# low, NOPs included
+  unsigned long dataBytes;     // Decoded words with D/C# high
+  unsigned long nops;
+  unsigned long unknownCommands;
+  unsigned long resets;
+  unsigned long corruptedBytes;   // SPI bytes sent faster than maxClock
+  unsigned long i2cTransmissions; // Wire transmissions to our address
+  unsigned long i2cBytes;         // Bytes in them, control bytes included
+  unsigned long controlBytes;
+  unsigned long framingErrors;    // Bad control bytes and transmissions with no payload
+};
+
+class VirtualSSD1320 : public HostBusListener {
+  public:
+    VirtualSSD1320(uint8_t csPin = 10, uint8_t rstPin = 8, uint8_t sclkPin = 13, uint8_t sdoutPin = 11,
+                   uint8_t dcPin = VIRTUAL_NO_PIN);
+    ~VirtualSSD1320();
+
+    void useI2C(uint8_t address = 0x3C);
+    void reset(void);
+    void clearCounters(void);
+    VirtualSSD1320Counters counters;
+
+    // Controller state
+    uint8_t gdram[VIRTUAL_GDRAM_ROWS][VIRTUAL_GDRAM_COLUMNS];
+    uint8_t columnStart, columnEnd, rowStart, rowEnd;
+    uint8_t column, row;
+    uint8_t startLine, displayOffset, multiplex;
+    uint8_t contrast;
+    boolean segmentRemap, comScanDecrement;
+    boolean displayOn, allOn, inverted;
+    uint8_t grayTable[15];
+    boolean customGrayTable;
+    boolean scrolling;
+    uint32_t spiClock;  // Clock of the current SPI transaction
+    uint32_t maxClock;  // Fastest clock the wiring passes cleanly, 0 for no limit
+    uint8_t scrollCommand, scrollArgs[6];
+    uint8_t scrollLine;
+
+    // What the panel shows
+    uint16_t width(void) { return VIRTUAL_PANEL_WIDTH; }
+    uint16_t height(void) { return multiplex + 1; }
+    uint8_t pixel(uint16_t x, uint16_t y);
+    uint8_t gdramPixel(uint16_t x, uint16_t y);
+    uint32_t frameChecksum(void);
+    bool dumpPGM(const char *path);
+
+    // Let the scroll engine run for some display frames
+    void advanceFrames(uint16_t frames);
+
+    // HostBusListener
+    void pinWrite(uint8_t pin, uint8_t value);
+    void spiBeginTransaction(uint32_t clock);
+    void spiTransfer(uint8_t data);
+    void i2cWrite(uint8_t address, const uint8_t *data, uint8_t length, uint32_t clock);
+
+  private:
+    uint8_t _cs, _rst, _sclk, _sd, _dc;
+    uint8_t _csLevel, _sclkLevel, _sdLevel, _rstLevel, _dcLevel;
+    uint8_t _i2cAddress;
+
+    uint16_t _shift;
+    uint8_t _bitCount;
+
+    uint8_t _command, _args[16], _argCount, _argsNeeded;
+    uint16_t _scrollFrames;
+
+    void shiftBit(uint8_t bit);
+    void word(uint16_t w);
+    void commandByte(uint8_t c);
+    void executeCommand(void);
+    void dataByte(uint8_t d);
+    void scrollStep(void);
+};
+
+#endif
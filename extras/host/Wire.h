@@ -0,0 +1,70 @@
+/*
+  Host shim for the Arduino Wire library. Each transmission is handed to the attached
+  HostBusListeners when endTransmission() is called. Like the AVR core it holds at most
+  BUFFER_LENGTH bytes per transmission. Bytes past that, nested beginTransmission()
+  calls and endTransmission() without beginTransmission() are counted as framing errors.
+*/
+
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+
+#include "Arduino.h"
+
+#define BUFFER_LENGTH 32
+
+class TwoWire {
+  public:
+    TwoWire() : clock(100000), transmissions(0), bytes(0), framingErrors(0), _active(false), _length(0) {}
+
+    void begin(void) { clock = 100000; }
+    void end(void) {}
+    void setClock(uint32_t frequency) { clock = frequency; }
+
+    void beginTransmission(uint8_t address) {
+      if (_active) framingErrors++;
+      _active = true;
+      _address = address;
+      _length = 0;
+    }
+
+    size_t write(uint8_t data) {
+      if (!_active || _length >= BUFFER_LENGTH) {
+        framingErrors++;
+        return 0;
+      }
+      _buffer[_length++] = data;
+      return 1;
+    }
+
+    size_t write(const uint8_t *data, size_t length) {
+      size_t sent = 0;
+      while (length--) sent += write(*data++);
+      return sent;
+    }
+
+    uint8_t endTransmission(bool sendStop = true) {
+      (void)sendStop;
+      if (!_active) {
+        framingErrors++;
+        return 4;
+      }
+      _active = false;
+      transmissions++;
+      bytes += _length + 1; // Address byte too
+      hostNotifyI2cWrite(_address, _buffer, _length, clock);
+      return 0;
+    }
+
+    uint32_t clock;
+    unsigned long transmissions, bytes, framingErrors;
+
+  private:
+    bool _active;
+    uint8_t _address;
+    uint8_t _buffer[BUFFER_LENGTH];
+    uint8_t _length;
+};
+
+extern TwoWire Wire;
+
+#endif
@@ -0,0 +1,2 @@
+// Host shim: PROGMEM is ordinary memory on the host
+#include "../Arduino.h"
@@ -0,0 +1,507 @@
+/*
+  Benchmark every drawing primitive and flush path on the host.
+
+  Each scene is run twice. The timing pass runs with the virtual SSD1320 detached so
+  the numbers are the library's own cost. The counting pass runs a single operation
+  with the model attached to count setPixel() calls, SPI bytes, CS toggles and pin
+  toggles. The Pong and text scenes are the loop bodies of Example6_Pong and
+  Example5_AllTheText.
+
+  Usage: bench [--csv] [--iterations N] [--record FILE | --check FILE] [--dump DIR] [scene ...]
+  --csv prints one machine readable line per scene instead of the table.
+  --record runs the golden pass and writes a checksum of the screen buffer, a checksum of
+  the image on the virtual panel and the bus cost of every scene to FILE.
+  --check runs the same pass and compares it with FILE. It exits with 1 if an image changed
+  or a cost went over its recorded budget. --dump writes the panel image of each failing
+  scene to DIR as a PGM.
+  See README.md in this folder for how to build it.
+*/
+
+#include <chrono> // Before the library, its swap() macro upsets the standard headers
+
+#include <SSD1320_OLED.h>
+#include "VirtualSSD1320.h"
+#include "../../examples/Example2_Graphics/che.h"
+#include "../../examples/Example17_CompressedImage/che_packed.h"
+
+unsigned long benchPixelCalls = 0;
+
+VirtualSSD1320 panel(10, 9, 13, 11);
+SSD1320 flexibleOLED(10, 9); //10 = CS, 9 = RES
+
+struct Scene {
+  const char *name;
+  unsigned long pixelsPerOp; // Pixels the operation covers, for pixels/s
+  void (*setup)(void);
+  void (*op)(unsigned long i);
+};
+
+static void clearBuffer(void) {
+  flexibleOLED.clearDisplay(CLEAR_BUFFER);
+  flexibleOLED.setFontType(0);
+  flexibleOLED.setDrawMode(NORM);
+  flexibleOLED.setColor(WHITE);
+}
+
+static void opSetPixel(unsigned long i) {
+  flexibleOLED.setPixel(i % 160, (i / 160) % 32);
+}
+
+static void opLine(unsigned long i) {
+  flexibleOLED.line(0, i % 32, 159, 31 - (i % 32));
+}
+
+static void opLineH(unsigned long i) {
+  flexibleOLED.lineH(0, i % 32, 159);
+}
+
+static void opLineV(unsigned long i) {
+  flexibleOLED.lineV(i % 160, 0, 31);
+}
+
+static void opRect(unsigned long i) {
+  flexibleOLED.rect(i % 80, 4, 60, 20);
+}
+
+static void opRectFill(unsigned long i) {
+  flexibleOLED.rectFill(i % 80, 6, 40, 20);
+}
+
+// Overlapping XOR outlines, the corners of rect() must stay lit
+static void opRectXor(unsigned long i) {
+  flexibleOLED.rect(i % 80, 4, 60, 20, WHITE, XOR);
+  flexibleOLED.rect(10 + i % 80, 8, 60, 20, WHITE, XOR);
+}
+
+static void opCircle(unsigned long i) {
+  flexibleOLED.circle(20 + i % 120, 16, 12);
+}
+
+static void opCircleFill(unsigned long i) {
+  flexibleOLED.circleFill(20 + i % 120, 16, 12);
+}
+
+static void opDrawChar5x7(unsigned long i) {
+  flexibleOLED.drawChar((i * 6) % 150, 8 * ((i / 25) % 4), 'A' + i % 26);
+}
+
+static void setupFont1(void) {
+  clearBuffer();
+  flexibleOLED.setFontType(1);
+}
+
+static void opDrawChar8x16(unsigned long i) {
+  flexibleOLED.drawChar((i * 8) % 150, 16 * ((i / 19) % 2), 'A' + i % 26);
+}
+
+static void opPrint(unsigned long i) {
+  flexibleOLED.setCursor(0, 8 * (i % 4));
+  flexibleOLED.print("Hello World!");
+}
+
+static void opDisplay(unsigned long i) {
+  (void)i;
+  flexibleOLED.display();
+}
+
+static void opClearAll(unsigned long i) {
+  (void)i;
+  flexibleOLED.clearDisplay(CLEAR_ALL);
+}
+
+static void opSelfTest(unsigned long i) {
+  (void)i;
+  flexibleOLED.selfTest();
+}
+
+static void opClearBuffer(unsigned long i) {
+  (void)i;
+  flexibleOLED.clearDisplay(CLEAR_BUFFER);
+}
+
+// A gray ramp under text, rendered a band at a time
+static void drawGrayBands(uint8_t top, uint8_t rows) {
+  (void)top;
+  (void)rows;
+  for (uint8_t level = 0 ; level < 16 ; level++)
+    flexibleOLED.rectFill(level * 10, 0, 10, 32, GRAY(level), NORM);
+  flexibleOLED.setCursor(4, 12);
+  flexibleOLED.setColor(GRAY(15 - 6));
+  flexibleOLED.print("Banded gray");
+}
+
+static void opGrayBands(unsigned long i) {
+  (void)i;
+  flexibleOLED.displayBanded(drawGrayBands);
+}
+
+// A 32x32 4bpp gray ramp, dithered into the screen buffer
+static uint8_t grayRamp[32 * 16];
+
+static void setupGrayImage(void) {
+  clearBuffer();
+  for (uint16_t i = 0 ; i < sizeof(grayRamp) ; i++)
+    grayRamp[i] = ((i % 16) & 0x0E) | (((i % 16) | 1) << 4); // Columns 0 to 31 step through levels 0 to 15
+}
+
+static void opGrayImage(unsigned long i) {
+  flexibleOLED.drawGrayImage((i * 32) % 160, 0, 32, 32, grayRamp, 4, DITHER_FLOYD);
+}
+
+// The raw che.h written byte by byte as Example2_Graphics does, and che_packed.h from
+// Example17_CompressedImage. Both must show the same picture.
+static void opCheRaw(unsigned long i) {
+  (void)i;
+  flexibleOLED.setRowAddress(0);
+  flexibleOLED.setColumnAddress(0);
+  for (uint16_t x = 0 ; x < sizeof(myGraphic) ; x++)
+    flexibleOLED.data(pgm_read_byte(myGraphic + x));
+}
+
+static void opChePacked(unsigned long i) {
+  (void)i;
+  flexibleOLED.displayImage(che);
+}
+
+// One frame of Example6_Pong
+static int paddleW, paddleH, paddle0_Y, paddle0_X, paddle1_Y, paddle1_X, ball_rad;
+static int ball_X, ball_Y, ballVelocityX, ballVelocityY, paddle0Velocity, paddle1Velocity;
+
+static void setupPong(void) {
+  clearBuffer();
+  randomSeed(1);
+  paddleW = 3;
+  paddleH = 15;
+  paddle0_Y = (flexibleOLED.getDisplayHeight() / 2) - (paddleH / 2);
+  paddle0_X = 2;
+  paddle1_Y = (flexibleOLED.getDisplayHeight() / 2) - (paddleH / 2);
+  paddle1_X = flexibleOLED.getDisplayWidth() - 3 - paddleW;
+  ball_rad = 2;
+  ball_X = paddle0_X + paddleW + ball_rad;
+  ball_Y = random(1 + ball_rad, flexibleOLED.getDisplayHeight() - ball_rad);
+  ballVelocityX = 1;
+  ballVelocityY = 1;
+  paddle0Velocity = -1;
+  paddle1Velocity = 1;
+}
+
+static void opPong(unsigned long i) {
+  (void)i;
+  if (!((ball_X - ball_rad > 1) && (ball_X + ball_rad < flexibleOLED.getDisplayWidth() - 2)))
+    setupPong();
+
+  ball_X += ballVelocityX;
+  ball_Y += ballVelocityY;
+  if (ball_X - ball_rad < paddle0_X + paddleW)
+    if ((ball_Y > paddle0_Y) && (ball_Y < paddle0_Y + paddleH)) {
+      ball_X++;
+      ballVelocityX = -ballVelocityX;
+    }
+  if (ball_X + ball_rad > paddle1_X)
+    if ((ball_Y > paddle1_Y) && (ball_Y < paddle1_Y + paddleH)) {
+      ball_X--;
+      ballVelocityX = -ballVelocityX;
+    }
+  if ((ball_Y <= ball_rad) || (ball_Y >= (flexibleOLED.getDisplayHeight() - ball_rad - 1)))
+    ballVelocityY = -ballVelocityY;
+  paddle0_Y += paddle0Velocity;
+  paddle1_Y += paddle1Velocity;
+  if ((paddle0_Y <= 1) || (paddle0_Y > flexibleOLED.getDisplayHeight() - 2 - paddleH))
+    paddle0Velocity = -paddle0Velocity;
+  if ((paddle1_Y <= 1) || (paddle1_Y > flexibleOLED.getDisplayHeight() - 2 - paddleH))
+    paddle1Velocity = -paddle1Velocity;
+
+  flexibleOLED.clearDisplay(CLEAR_BUFFER);
+  flexibleOLED.rect(0, 0, flexibleOLED.getDisplayWidth() - 1, flexibleOLED.getDisplayHeight());
+  flexibleOLED.rectFill(flexibleOLED.getDisplayWidth() / 2 - 1, 0, 2, flexibleOLED.getDisplayHeight());
+  flexibleOLED.rectFill(paddle0_X, paddle0_Y, paddleW, paddleH);
+  flexibleOLED.rectFill(paddle1_X, paddle1_Y, paddleW, paddleH);
+  flexibleOLED.circle(ball_X, ball_Y, ball_rad);
+  flexibleOLED.display();
+}
+
+// The small text screen of Example5_AllTheText
+static void opTextScreen(unsigned long i) {
+  (void)i;
+  flexibleOLED.setFontType(0);
+  byte thisFontHeight = flexibleOLED.getFontHeight();
+  flexibleOLED.clearDisplay();
+  flexibleOLED.setCursor(0, thisFontHeight * 3);
+  flexibleOLED.print("ABCDEFGHIJKLMNOPQRSTUVWXYZ");
+  flexibleOLED.setCursor(0, thisFontHeight * 2);
+  flexibleOLED.print("abcdefghijklmnopqrstuvwxyz");
+  flexibleOLED.setCursor(0, thisFontHeight * 1);
+  flexibleOLED.print("1234567890!@#$%^&*(),.<>/?");
+  flexibleOLED.setCursor(0, thisFontHeight * 0);
+  flexibleOLED.print(";:'\"[]{}-=_+|\\~`");
+  flexibleOLED.display();
+}
+
+static const Scene scenes[] = {
+  {"setPixel",       1,    clearBuffer, opSetPixel},
+  {"line",           160,  clearBuffer, opLine},
+  {"lineH",          160,  clearBuffer, opLineH},
+  {"lineV",          32,   clearBuffer, opLineV},
+  {"rect",           156,  clearBuffer, opRect},
+  {"rectFill",       800,  clearBuffer, opRectFill},
+  {"rectXor",        312,  clearBuffer, opRectXor},
+  {"circle",         76,   clearBuffer, opCircle},
+  {"circleFill",     452,  clearBuffer, opCircleFill},
+  {"drawChar5x7",    48,   clearBuffer, opDrawChar5x7},
+  {"drawChar8x16",   128,  setupFont1,  opDrawChar8x16},
+  {"print12",        576,  clearBuffer, opPrint},
+  {"clearBuffer",    5120, clearBuffer, opClearBuffer},
+  {"clearAll",       5120, clearBuffer, opClearAll},
+  {"display",        5120, clearBuffer, opDisplay},
+  {"selfTest",       5120, clearBuffer, opSelfTest},
+  {"grayBands",      5120, clearBuffer, opGrayBands},
+  {"grayImage",      1024, setupGrayImage, opGrayImage},
+  {"cheRaw",         5120, clearBuffer, opCheRaw},
+  {"chePacked",      5120, clearBuffer, opChePacked},
+  {"pongFrame",      5120, setupPong,   opPong},
+  {"textScreen",     5120, clearBuffer, opTextScreen},
+};
+
+#define TOTALSCENES (sizeof(scenes) / sizeof(scenes[0]))
+
+struct Result {
+  double nsPerOp;
+  double pixelsPerSecond;
+  unsigned long setPixelCalls, spiBytes, csToggles, pinToggles, commandBytes, dataBytes;
+};
+
+static Result runScene(const Scene &scene, unsigned long iterations) {
+  Result result;
+
+  // Timing pass, nothing listening on the bus
+  hostDetach(&panel);
+  scene.setup();
+  for (unsigned long i = 0 ; i < iterations / 10 + 1 ; i++) scene.op(i); // Warm up
+  scene.setup();
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (unsigned long i = 0 ; i < iterations ; i++) scene.op(i);
+  double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+  hostAttach(&panel);
+
+  result.nsPerOp = ns / iterations;
+  result.pixelsPerSecond = scene.pixelsPerOp * 1e9 / result.nsPerOp;
+
+  // Counting pass, one operation
+  scene.setup();
+  panel.clearCounters();
+  benchPixelCalls = 0;
+  scene.op(1);
+  result.setPixelCalls = benchPixelCalls;
+  result.spiBytes = panel.counters.spiBytes;
+  result.csToggles = panel.counters.csToggles;
+  result.pinToggles = panel.counters.pinToggles;
+  result.commandBytes = panel.counters.commandBytes;
+  result.dataBytes = panel.counters.dataBytes;
+
+  return result;
+}
+
+// Golden pass: a few operations from a clean setup, then a flush to see the result on the panel
+#define GOLDENOPS 8
+
+struct Golden {
+  char scene[32];
+  unsigned long bufferSum, panelSum, setPixelCalls, spiBytes, commandBytes, dataBytes;
+};
+
+static unsigned long bufferChecksum(void) {
+  uint32_t hash = 2166136261UL;
+  uint8_t *buffer = flexibleOLED.getScreenBuffer();
+  for (uint16_t x = 0 ; x < 640 ; x++)
+    hash = (hash ^ buffer[x]) * 16777619UL;
+  return hash;
+}
+
+// Scenes that write GDRAM themselves, a flush of the empty screen buffer would hide them
+static bool drawsOnPanel(const Scene &scene) {
+  return scene.op == opSelfTest || scene.op == opGrayBands || scene.op == opCheRaw || scene.op == opChePacked;
+}
+
+// Pairs of scenes that draw the same picture in different ways
+static const char *sameImage[][2] = {
+  {"cheRaw", "chePacked"},
+};
+
+#define TOTALSAMEIMAGE (sizeof(sameImage) / sizeof(sameImage[0]))
+
+static Golden runGolden(const Scene &scene) {
+  Golden golden;
+  snprintf(golden.scene, sizeof(golden.scene), "%s", scene.name);
+
+  flexibleOLED.clearDisplay(CLEAR_ALL);
+  scene.setup();
+  panel.clearCounters();
+  benchPixelCalls = 0;
+  for (unsigned long i = 0 ; i < GOLDENOPS ; i++) scene.op(i);
+  golden.setPixelCalls = benchPixelCalls;
+  golden.spiBytes = panel.counters.spiBytes;
+  golden.commandBytes = panel.counters.commandBytes;
+  golden.dataBytes = panel.counters.dataBytes;
+
+  golden.bufferSum = bufferChecksum();
+  if (!drawsOnPanel(scene)) flexibleOLED.display();
+  golden.panelSum = panel.frameChecksum();
+  return golden;
+}
+
+#define GOLDENFORMAT "%31[^,],%lx,%lx,%lu,%lu,%lu,%lu"
+#define GOLDENHEADER "scene,buffer_sum,panel_sum,setpixel_calls,spi_bytes,command_bytes,data_bytes"
+
+static int loadGolden(const char *path, Golden *goldens, int max) {
+  FILE *file = fopen(path, "r");
+  if (file == NULL) return -1;
+
+  char line[256];
+  int count = 0;
+  while (count < max && fgets(line, sizeof(line), file) != NULL) {
+    Golden &g = goldens[count];
+    if (sscanf(line, GOLDENFORMAT, g.scene, &g.bufferSum, &g.panelSum, &g.setPixelCalls,
+               &g.spiBytes, &g.commandBytes, &g.dataBytes) == 7)
+      count++; // The header line does not parse
+  }
+  fclose(file);
+  return count;
+}
+
+// Returns false if the scene drew something different or went over budget
+static bool checkGolden(const Golden &want, const Golden &got, const char *dumpDir) {
+  bool pass = true;
+
+  if (got.bufferSum != want.bufferSum) {
+    printf("%s: screen buffer changed (%08lx, golden %08lx)\n", got.scene, got.bufferSum, want.bufferSum);
+    pass = false;
+  }
+  if (got.panelSum != want.panelSum) {
+    printf("%s: panel image changed (%08lx, golden %08lx)\n", got.scene, got.panelSum, want.panelSum);
+    pass = false;
+  }
+
+  const char *names[] = {"setPixel calls", "SPI bytes", "command bytes", "data bytes"};
+  unsigned long budget[] = {want.setPixelCalls, want.spiBytes, want.commandBytes, want.dataBytes};
+  unsigned long used[] = {got.setPixelCalls, got.spiBytes, got.commandBytes, got.dataBytes};
+  for (int x = 0 ; x < 4 ; x++) {
+    if (used[x] > budget[x]) {
+      printf("%s: %lu %s, budget %lu\n", got.scene, used[x], names[x], budget[x]);
+      pass = false;
+    } else if (used[x] < budget[x])
+      printf("%s: %lu %s, under budget %lu, record again to tighten it\n", got.scene, used[x], names[x], budget[x]);
+  }
+
+  if (!pass && dumpDir != NULL) {
+    char path[256];
+    snprintf(path, sizeof(path), "%s/%s.pgm", dumpDir, got.scene);
+    panel.dumpPGM(path);
+  }
+  return pass;
+}
+
+int main(int argc, char **argv) {
+  bool csv = false;
+  unsigned long iterations = 2000;
+  const char *only[TOTALSCENES];
+  int onlyCount = 0;
+  const char *recordPath = NULL;
+  const char *checkPath = NULL;
+  const char *dumpDir = NULL;
+
+  for (int x = 1 ; x < argc ; x++) {
+    if (strcmp(argv[x], "--csv") == 0) csv = true;
+    else if (strcmp(argv[x], "--iterations") == 0 && x + 1 < argc) iterations = strtoul(argv[++x], NULL, 10);
+    else if (strcmp(argv[x], "--record") == 0 && x + 1 < argc) recordPath = argv[++x];
+    else if (strcmp(argv[x], "--check") == 0 && x + 1 < argc) checkPath = argv[++x];
+    else if (strcmp(argv[x], "--dump") == 0 && x + 1 < argc) dumpDir = argv[++x];
+    else if (onlyCount < (int)TOTALSCENES) only[onlyCount++] = argv[x];
+  }
+  if (iterations == 0) iterations = 1;
+
+  flexibleOLED.begin(160, 32);
+
+  if (recordPath != NULL || checkPath != NULL) {
+    Golden goldens[TOTALSCENES];
+    int goldenCount = 0;
+    FILE *record = NULL;
+
+    if (recordPath != NULL) {
+      record = fopen(recordPath, "w");
+      if (record == NULL) {
+        printf("Can't write %s\n", recordPath);
+        return 2;
+      }
+      fprintf(record, GOLDENHEADER "\n");
+    } else {
+      goldenCount = loadGolden(checkPath, goldens, TOTALSCENES);
+      if (goldenCount < 0) {
+        printf("Can't read %s\n", checkPath);
+        return 2;
+      }
+    }
+
+    int failures = 0;
+    Golden results[TOTALSCENES];
+    for (size_t s = 0 ; s < TOTALSCENES ; s++) {
+      Golden got = runGolden(scenes[s]);
+      results[s] = got;
+      if (record != NULL) {
+        fprintf(record, "%s,%08lx,%08lx,%lu,%lu,%lu,%lu\n", got.scene, got.bufferSum, got.panelSum,
+                got.setPixelCalls, got.spiBytes, got.commandBytes, got.dataBytes);
+        continue;
+      }
+
+      int match = -1;
+      for (int x = 0 ; x < goldenCount ; x++)
+        if (strcmp(goldens[x].scene, got.scene) == 0) match = x;
+      if (match < 0)
+        printf("%s: not in %s, record it\n", got.scene, checkPath);
+      else if (!checkGolden(goldens[match], got, dumpDir))
+        failures++;
+    }
+
+    for (size_t p = 0 ; p < TOTALSAMEIMAGE ; p++) {
+      const Golden *pair[2] = {NULL, NULL};
+      for (size_t s = 0 ; s < TOTALSCENES ; s++)
+        for (int x = 0 ; x < 2 ; x++)
+          if (strcmp(results[s].scene, sameImage[p][x]) == 0) pair[x] = &results[s];
+      if (pair[0] != NULL && pair[1] != NULL && pair[0]->panelSum != pair[1]->panelSum) {
+        printf("%s and %s: panel images differ (%08lx, %08lx)\n", pair[0]->scene, pair[1]->scene,
+               pair[0]->panelSum, pair[1]->panelSum);
+        failures++;
+      }
+    }
+
+    if (record != NULL) {
+      fclose(record);
+      printf("Recorded %u scenes to %s\n", (unsigned)TOTALSCENES, recordPath);
+      return failures ? 1 : 0;
+    }
+    printf("%d of %u scenes failed\n", failures, (unsigned)TOTALSCENES);
+    return failures ? 1 : 0;
+  }
+
+  if (csv)
+    printf("scene,ns_per_op,pixels_per_s,setpixel_calls,spi_bytes,cs_toggles,pin_toggles,command_bytes,data_bytes\n");
+  else
+    printf("%-14s %12s %14s %9s %8s %7s %8s %6s %6s\n", "scene", "ns/op", "pixels/s", "setPixel",
+           "spiBytes", "csTogg", "pinTogg", "cmd", "data");
+
+  for (size_t s = 0 ; s < TOTALSCENES ; s++) {
+    bool wanted = (onlyCount == 0);
+    for (int x = 0 ; x < onlyCount ; x++)
+      if (strcmp(only[x], scenes[s].name) == 0) wanted = true;
+    if (!wanted) continue;
+
+    Result r = runScene(scenes[s], iterations);
+    if (csv)
+      printf("%s,%.1f,%.0f,%lu,%lu,%lu,%lu,%lu,%lu\n", scenes[s].name, r.nsPerOp, r.pixelsPerSecond,
+             r.setPixelCalls, r.spiBytes, r.csToggles, r.pinToggles, r.commandBytes, r.dataBytes);
+    else
+      printf("%-14s %12.1f %14.0f %9lu %8lu %7lu %8lu %6lu %6lu\n", scenes[s].name, r.nsPerOp, r.pixelsPerSecond,
+             r.setPixelCalls, r.spiBytes, r.csToggles, r.pinToggles, r.commandBytes, r.dataBytes);
+  }
+
+  return 0;
+}
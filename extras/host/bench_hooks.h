@@ -0,0 +1,8 @@
+// Force included (-include) into every file of the benchmark build to count setPixel() calls
+#ifndef BENCH_HOOKS_H
+#define BENCH_HOOKS_H
+
+extern unsigned long benchPixelCalls;
+#define SSD1320_PIXEL_HOOK() (benchPixelCalls++)
+
+#endif
@@ -0,0 +1,97 @@
+/*
+  Decode a BMP file with SSD1320_BMP onto the virtual panel and save what it shows.
+
+  Usage: bmp [--bayer | --floyd] [--nearest] [--center | --fit | --scale x y w h | x y] image.bmp [frame.pgm]
+  --fit and --scale shrink the image into the display or a w x h box, by box average or
+  with --nearest by picking pixels.
+  Prints the decoder's result, the image size and the bus cost. Exits with 1 if the
+  image was not drawn.
+  See README.md in this folder for how to build it.
+*/
+
+#include <ctype.h>
+
+#include <SSD1320_OLED.h>
+#include <SSD1320_BMP.h>
+#include "VirtualSSD1320.h"
+#include "HostFileStream.h"
+
+VirtualSSD1320 panel(10, 9, 13, 11);
+SSD1320 flexibleOLED(10, 9); //10 = CS, 9 = RES
+
+int main(int argc, char **argv) {
+  bool center = false, scale = false;
+  int x = 0, y = 0, width = 160, height = 32;
+  uint8_t dither = DITHER_NONE;
+  uint8_t scaling = SCALE_BOX;
+  int arg = 1;
+
+  if (arg < argc && strcmp(argv[arg], "--bayer") == 0) {
+    dither = DITHER_BAYER;
+    arg++;
+  }
+  else if (arg < argc && strcmp(argv[arg], "--floyd") == 0) {
+    dither = DITHER_FLOYD;
+    arg++;
+  }
+
+  if (arg < argc && strcmp(argv[arg], "--nearest") == 0) {
+    scaling = SCALE_NEAREST;
+    arg++;
+  }
+
+  if (arg < argc && strcmp(argv[arg], "--center") == 0) {
+    center = true;
+    arg++;
+  }
+  else if (arg < argc && strcmp(argv[arg], "--fit") == 0) {
+    scale = true;
+    arg++;
+  }
+  else if (arg + 5 < argc && strcmp(argv[arg], "--scale") == 0) {
+    scale = true;
+    x = atoi(argv[arg + 1]);
+    y = atoi(argv[arg + 2]);
+    width = atoi(argv[arg + 3]);
+    height = atoi(argv[arg + 4]);
+    arg += 5;
+  }
+  else if (arg + 2 < argc && (isdigit(argv[arg][0]) || argv[arg][0] == '-')) {
+    x = atoi(argv[arg]);
+    y = atoi(argv[arg + 1]);
+    arg += 2;
+  }
+  if (arg >= argc) {
+    fprintf(stderr, "Usage: %s [--bayer | --floyd] [--nearest] [--center | --fit | --scale x y w h | x y] image.bmp [frame.pgm]\n", argv[0]);
+    return 2;
+  }
+
+  HostFileStream file(argv[arg]);
+  if (!file.isOpen()) {
+    perror(argv[arg]);
+    return 2;
+  }
+  file.setTimeout(10); // The file won't grow, don't wait long at its end
+
+  flexibleOLED.begin(160, 32);
+  flexibleOLED.clearDisplay();
+  panel.clearCounters();
+
+  SSD1320_BMP bmp(flexibleOLED);
+  bmp.setDither(dither);
+  bmp.setScaling(scaling);
+  uint8_t result;
+  if (scale)
+    result = bmp.drawScaled(file, x, y, width, height);
+  else
+    result = center ? bmp.drawCentered(file) : bmp.draw(file, x, y);
+
+  const char *names[] = {"ok", "not a BMP", "unsupported", "timed out"};
+  printf("%s: %s, %dx%d, %u bits per pixel\n", argv[arg], names[result], bmp.getWidth(), bmp.getHeight(),
+         bmp.getBitsPerPixel());
+  printf("read %lu bytes, sent %lu command and %lu data bytes, %lu SPI bytes\n", file.bytesRead,
+         panel.counters.commandBytes, panel.counters.dataBytes, panel.counters.spiBytes);
+
+  if (arg + 1 < argc) panel.dumpPGM(argv[arg + 1]);
+  return result == BMP_OK ? 0 : 1;
+}
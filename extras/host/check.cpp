@@ -0,0 +1,904 @@
+/*
+  Self-checks for the image code on the virtual SSD1320.
+
+  Each check draws with a library feature and compares what the panel shows with a plain
+  reference: the expected pixel levels worked out directly, or the same picture drawn
+  another way. Exits with 1 on any mismatch.
+
+  Usage: check [name ...]
+  With no names every check runs. See README.md in this folder for how to build it.
+*/
+
+#include <vector> // Before the library, its swap() macro upsets the standard headers
+
+#include <SSD1320_OLED.h>
+#include <SSD1320_BMP.h>
+#include <SSD1320_Animation.h>
+#include <SSD1320_Image.h>
+#include <SSD1320_Sprites.h>
+#include <SSD1320_Labels.h>
+#include "VirtualSSD1320.h"
+#include "HostMemoryStream.h"
+#include "../../examples/Example18_Animation/bootAnimation.h"
+
+VirtualSSD1320 panel(10, 9, 13, 11);
+SSD1320 flexibleOLED(10, 9); //10 = CS, 9 = RES
+
+static int failures = 0;
+
+static void check(bool ok, const char *what) {
+  printf("%-56s %s\n", what, ok ? "ok" : "FAILED");
+  if (!ok) failures++;
+}
+
+// Test pattern: a gray level for every pixel, y counted from the bottom of the image
+static uint8_t patternLevel(int x, int y, int bitsPerPixel) {
+  uint8_t level = (x * 3 + y * 5 + (x / 7) * y) % 16;
+  if (bitsPerPixel == 1) return (level & 1) ? 15 : 0;
+  return level;
+}
+
+static void put16(std::vector<uint8_t> &out, uint16_t value) {
+  out.push_back(value);
+  out.push_back(value >> 8);
+}
+
+static void put32(std::vector<uint8_t> &out, uint32_t value) {
+  put16(out, value);
+  put16(out, value >> 16);
+}
+
+// A BMP of the test pattern. 8-bit images use 16 palette entries per level so the whole index
+// range is exercised; with colorsUsed set, only that many entries are stored.
+static std::vector<uint8_t> makeBMP(int width, int height, int bitsPerPixel, bool topDown, int colorsUsed = 0) {
+  int colors = (bitsPerPixel <= 8) ? (1 << bitsPerPixel) : 0;
+  if (colorsUsed > 0) colors = colorsUsed;
+  uint32_t rowBytes = ((uint32_t)width * bitsPerPixel + 31) / 32 * 4;
+  uint32_t offset = 14 + 40 + colors * 4;
+
+  std::vector<uint8_t> out;
+  out.push_back('B');
+  out.push_back('M');
+  put32(out, offset + rowBytes * height);
+  put32(out, 0);
+  put32(out, offset);
+  put32(out, 40);
+  put32(out, width);
+  put32(out, topDown ? -height : height);
+  put16(out, 1);
+  put16(out, bitsPerPixel);
+  put32(out, 0);
+  put32(out, rowBytes * height);
+  put32(out, 2835);
+  put32(out, 2835);
+  put32(out, colorsUsed);
+  put32(out, 0);
+
+  for (int i = 0 ; i < colors ; i++) {
+    uint8_t gray = (bitsPerPixel == 1) ? i * 255 : (bitsPerPixel == 4) ? i * 17 : (i >> 4) * 17;
+    out.push_back(gray);
+    out.push_back(gray);
+    out.push_back(gray);
+    out.push_back(0);
+  }
+
+  for (int row = 0 ; row < height ; row++) {
+    int y = topDown ? height - 1 - row : row;
+    std::vector<uint8_t> bits(rowBytes, 0);
+    for (int x = 0 ; x < width ; x++) {
+      uint8_t level = patternLevel(x, y, bitsPerPixel);
+      if (bitsPerPixel == 1)
+        bits[x / 8] |= (level ? 0x80 : 0) >> (x % 8);
+      else if (bitsPerPixel == 4)
+        bits[x / 2] |= level << ((x & 1) ? 0 : 4);
+      else if (bitsPerPixel == 8)
+        bits[x] = (level << 4) | (x & 0x0F);
+      else
+        bits[x * 3] = bits[x * 3 + 1] = bits[x * 3 + 2] = level * 17;
+    }
+    out.insert(out.end(), bits.begin(), bits.end());
+  }
+  return out;
+}
+
+// Pixels of the panel that differ from the pattern drawn at x,y, with everything else black
+static int countPatternErrors(int x, int y, int width, int height, int bitsPerPixel) {
+  int errors = 0;
+  for (int py = 0 ; py < SSD1320_HEIGHT ; py++)
+    for (int px = 0 ; px < SSD1320_WIDTH ; px++) {
+      int ix = px - x, iy = py - y;
+      bool inside = (ix >= 0 && ix < width && iy >= 0 && iy < height);
+      uint8_t want = inside ? patternLevel(ix, iy, bitsPerPixel) : 0;
+      if (panel.gdramPixel(px, py) != want) errors++;
+    }
+  return errors;
+}
+
+static void checkBMP(void) {
+  SSD1320_BMP bmp(flexibleOLED);
+  const int depths[] = {1, 4, 8, 24};
+  const int sizes[][2] = {{1, 1}, {7, 3}, {33, 9}, {160, 32}, {203, 41}};
+  const int places[][2] = {{0, 0}, {5, 3}, {-3, -2}, {150, 28}};
+
+  for (int d = 0 ; d < 4 ; d++) {
+    int bad = 0, cases = 0;
+    for (int topDown = 0 ; topDown < 2 ; topDown++)
+      for (int s = 0 ; s < 5 ; s++)
+        for (int p = 0 ; p < 4 ; p++) {
+          std::vector<uint8_t> file = makeBMP(sizes[s][0], sizes[s][1], depths[d], topDown);
+          size_t length = file.size();
+          file.insert(file.end(), 4, 0xEE); //Whatever follows the image must not be read
+
+          flexibleOLED.clearDisplay(CLEAR_ALL);
+          HostMemoryStream stream(file.data(), file.size());
+          uint8_t result = bmp.draw(stream, places[p][0], places[p][1]);
+          cases++;
+          if (result != BMP_OK || stream.bytesRead != length ||
+              countPatternErrors(places[p][0], places[p][1], sizes[s][0], sizes[s][1], depths[d]) != 0)
+            bad++;
+        }
+
+    char what[64];
+    snprintf(what, sizeof(what), "bmp %2d bpp, bottom-up and top-down, %d cases", depths[d], cases);
+    check(bad == 0, what);
+  }
+
+  //Indexes past the stored palette are black
+  std::vector<uint8_t> file = makeBMP(64, 4, 8, false, 20);
+  flexibleOLED.clearDisplay(CLEAR_ALL);
+  HostMemoryStream stream(file.data(), file.size());
+  bmp.draw(stream);
+  int bad = 0;
+  for (int y = 0 ; y < 4 ; y++)
+    for (int x = 0 ; x < 64 ; x++) {
+      uint8_t level = patternLevel(x, y, 8);
+      uint8_t want = ((level << 4 | (x & 0x0F)) < 20) ? level : 0;
+      if (panel.gdramPixel(x, y) != want) bad++;
+    }
+  check(bad == 0, "bmp 8 bpp, indexes past colorsUsed are black");
+
+  //A 24-bit row longer than 64 KB
+  file = makeBMP(21847, 2, 24, false);
+  size_t length = file.size();
+  file.insert(file.end(), 4, 0xEE);
+  flexibleOLED.clearDisplay(CLEAR_ALL);
+  HostMemoryStream wide(file.data(), file.size());
+  uint8_t result = bmp.draw(wide);
+  check(result == BMP_OK && wide.bytesRead == length && countPatternErrors(0, 0, 21847, 2, 24) == 0,
+        "bmp 24 bpp, 21847 pixels wide, reads exactly the image");
+
+  //A stream that stops halfway
+  file = makeBMP(40, 20, 4, false);
+  HostMemoryStream cut(file.data(), file.size());
+  cut.limit = file.size() / 2;
+  cut.setTimeout(1);
+  check(bmp.draw(cut) == BMP_TIMEOUT, "bmp cut short reports BMP_TIMEOUT");
+}
+
+// Reference for SSD1320_Scaler: shrink a sourceWidth x sourceHeight gray image, rows in the
+// order they stream in, to width x height. Nearest takes the source pixel under the center
+// of each output pixel. Box averages the pixels whose x * width / sourceWidth and
+// y * height / sourceHeight land on it, each row rounded first, then the rows.
+static std::vector<uint8_t> referenceScale(const std::vector<uint8_t> &source, int sourceWidth, int sourceHeight,
+                                           int width, int height, uint8_t method) {
+  std::vector<uint8_t> out(width * height);
+  for (int r = 0 ; r < height ; r++)
+    for (int c = 0 ; c < width ; c++) {
+      if (method == SCALE_NEAREST) {
+        int sx = (2 * c + 1) * sourceWidth / (2 * width);
+        int sy = (2 * r + 1) * sourceHeight / (2 * height);
+        out[r * width + c] = source[sy * sourceWidth + sx];
+        continue;
+      }
+
+      int rowSum = 0, rows = 0;
+      for (int sy = 0 ; sy < sourceHeight ; sy++) {
+        if (sy * height / sourceHeight != r) continue;
+        int sum = 0, count = 0;
+        for (int sx = 0 ; sx < sourceWidth ; sx++)
+          if (sx * width / sourceWidth == c) {
+            sum += source[sy * sourceWidth + sx];
+            count++;
+          }
+        rowSum += (sum + count / 2) / count;
+        rows++;
+      }
+      out[r * width + c] = (rowSum + rows / 2) / rows;
+    }
+  return out;
+}
+
+// Smooth and hard-edged test content, 0 to 255
+static uint8_t scaleGray(int x, int y) {
+  if ((x / 9 + y / 5) % 3 == 0) return 255;
+  return (x * 7 + y * 3) % 256;
+}
+
+// An 8-bit BMP whose palette index is the gray level, rows as given by scaleGray() in file order
+static std::vector<uint8_t> makeGrayBMP(int width, int height, bool topDown) {
+  std::vector<uint8_t> out = makeBMP(width, height, 8, topDown);
+  size_t pixels = out.size() - (size_t)((width + 3) / 4 * 4) * height;
+  for (int i = 0 ; i < 256 ; i++)
+    for (int c = 0 ; c < 3 ; c++)
+      out[14 + 40 + i * 4 + c] = i;
+  for (int row = 0 ; row < height ; row++)
+    for (int x = 0 ; x < width ; x++)
+      out[pixels + (size_t)row * ((width + 3) / 4 * 4) + x] = scaleGray(x, row);
+  return out;
+}
+
+static void checkScaler(void) {
+  SSD1320_BMP bmp(flexibleOLED);
+  const uint8_t methods[] = {SCALE_NEAREST, SCALE_BOX};
+  const char *names[] = {"nearest", "box"};
+  const int sources[][2] = {{200, 200}, {400, 50}, {161, 33}, {1000, 7}, {320, 64}, {37, 90}};
+  const int boxes[][4] = {{0, 0, 160, 32}, {10, 4, 100, 20}, {131, 3, 25, 27}};
+  char what[64];
+
+  //drawScaled(), rounded to the 16 levels
+  for (int m = 0 ; m < 2 ; m++) {
+    int bad = 0, cases = 0;
+    bmp.setScaling(methods[m]);
+    for (int topDown = 0 ; topDown < 2 ; topDown++)
+      for (int s = 0 ; s < 6 ; s++)
+        for (int b = 0 ; b < 3 ; b++) {
+          int sw = sources[s][0], sh = sources[s][1];
+          std::vector<uint8_t> file = makeGrayBMP(sw, sh, topDown);
+          std::vector<uint8_t> source(sw * sh);
+          for (int y = 0 ; y < sh ; y++)
+            for (int x = 0 ; x < sw ; x++)
+              source[y * sw + x] = scaleGray(x, y);
+
+          uint8_t width = boxes[b][2], height = boxes[b][3];
+          SSD1320_Scaler::fit(sw, sh, width, height);
+          std::vector<uint8_t> scaled = referenceScale(source, sw, sh, width, height, methods[m]);
+          int x = boxes[b][0] + (boxes[b][2] - width) / 2;
+          int y = boxes[b][1] + (boxes[b][3] - height) / 2;
+
+          flexibleOLED.clearDisplay(CLEAR_ALL);
+          HostMemoryStream stream(file.data(), file.size());
+          cases++;
+          if (bmp.drawScaled(stream, boxes[b][0], boxes[b][1], boxes[b][2], boxes[b][3]) != BMP_OK) {
+            bad++;
+            continue;
+          }
+
+          int errors = 0;
+          for (int py = 0 ; py < SSD1320_HEIGHT ; py++)
+            for (int px = 0 ; px < SSD1320_WIDTH ; px++) {
+              int c = px - x, r = py - y;
+              if (topDown) r = height - 1 - r;
+              uint8_t want = 0;
+              if (c >= 0 && c < width && r >= 0 && r < height)
+                want = ((uint16_t)scaled[r * width + c] * 15 + 127) / 255;
+              if (panel.gdramPixel(px, py) != want) errors++;
+            }
+          if (errors) bad++;
+        }
+    snprintf(what, sizeof(what), "scaler %s, drawScaled() BMPs, %d cases", names[m], cases);
+    check(bad == 0, what);
+  }
+
+  //drawImage() and displayImage() of compressed format images, 4 and 1 bits per pixel
+  const int images[][3] = {{160, 96, 4}, {150, 200, 4}, {120, 64, 1}, {33, 255, 1}};
+  for (int m = 0 ; m < 2 ; m++) {
+    int bad = 0, cases = 0;
+    for (int i = 0 ; i < 4 ; i++)
+      for (int b = 0 ; b < 3 ; b++) {
+        int sw = images[i][0], sh = images[i][1], bitsPerPixel = images[i][2];
+        int stride = (bitsPerPixel == 4) ? (sw + 1) / 2 : (sw + 7) / 8;
+        std::vector<uint8_t> image(IMAGE_HEADERSIZE + stride * sh, 0);
+        image[0] = (bitsPerPixel == 4) ? IMAGE_4BPP : IMAGE_1BPP;
+        image[1] = sw;
+        image[2] = sh;
+        std::vector<uint8_t> source(sw * sh);
+        for (int y = 0 ; y < sh ; y++)
+          for (int x = 0 ; x < sw ; x++) {
+            uint8_t level = scaleGray(x, y) >> 4;
+            uint8_t *byte = &image[IMAGE_HEADERSIZE + y * stride];
+            if (bitsPerPixel == 4) {
+              byte[x / 2] |= level << ((x & 1) ? 4 : 0);
+              source[y * sw + x] = level * 17;
+            } else {
+              if (level & 8) byte[x / 8] |= 0x80 >> (x % 8);
+              source[y * sw + x] = (level & 8) ? 255 : 0;
+            }
+          }
+
+        uint8_t width = boxes[b][2], height = boxes[b][3];
+        SSD1320_Scaler::fit(sw, sh, width, height);
+        std::vector<uint8_t> scaled = referenceScale(source, sw, sh, width, height, methods[m]);
+        int x = boxes[b][0] + (boxes[b][2] - width) / 2;
+        int y = boxes[b][1] + (boxes[b][3] - height) / 2;
+
+        //drawImage() dithers into the black and white screen buffer
+        flexibleOLED.clearDisplay(CLEAR_ALL);
+        flexibleOLED.drawImage(image.data(), boxes[b][0], boxes[b][1], boxes[b][2], boxes[b][3], methods[m]);
+        flexibleOLED.display();
+        SSD1320_Dither dither(DITHER_FLOYD);
+        dither.begin(2);
+        std::vector<uint8_t> want(SSD1320_WIDTH * SSD1320_HEIGHT, 0);
+        for (int r = 0 ; r < height ; r++) {
+          dither.nextRow();
+          for (int c = 0 ; c < width ; c++) {
+            uint8_t level = dither.pixel(x + c, scaled[r * width + c]);
+            if (x + c < SSD1320_WIDTH && y + r < SSD1320_HEIGHT)
+              want[(y + r) * SSD1320_WIDTH + x + c] = level ? 15 : 0;
+          }
+        }
+        int errors = 0;
+        for (int py = 0 ; py < SSD1320_HEIGHT ; py++)
+          for (int px = 0 ; px < SSD1320_WIDTH ; px++)
+            if (panel.gdramPixel(px, py) != want[py * SSD1320_WIDTH + px]) errors++;
+
+        //displayImage() rounds to the 16 levels, from an even column
+        flexibleOLED.clearDisplay(CLEAR_ALL);
+        flexibleOLED.displayImage(image.data(), boxes[b][0], boxes[b][1], boxes[b][2], boxes[b][3], methods[m]);
+        int even = x & ~1;
+        for (int py = 0 ; py < SSD1320_HEIGHT ; py++)
+          for (int px = 0 ; px < SSD1320_WIDTH ; px++) {
+            int c = px - even, r = py - y;
+            uint8_t level = 0;
+            if (c >= 0 && c < width && r >= 0 && r < height)
+              level = ((uint16_t)scaled[r * width + c] * 15 + 127) / 255;
+            if (panel.gdramPixel(px, py) != level) errors++;
+          }
+
+        cases++;
+        if (errors) bad++;
+      }
+    snprintf(what, sizeof(what), "scaler %s, drawImage() and displayImage(), %d cases", names[m], cases);
+    check(bad == 0, what);
+  }
+}
+
+// Raw sprite images, 1 and 4 bits per pixel, with see-through holes
+static std::vector<uint8_t> makeSpriteImage(int width, int height, int bitsPerPixel, int seed) {
+  int stride = (bitsPerPixel == 4) ? (width + 1) / 2 : (width + 7) / 8;
+  std::vector<uint8_t> image(IMAGE_HEADERSIZE + stride * height, 0);
+  image[0] = (bitsPerPixel == 4) ? IMAGE_4BPP : IMAGE_1BPP;
+  image[1] = width;
+  image[2] = height;
+  for (int y = 0 ; y < height ; y++)
+    for (int x = 0 ; x < width ; x++) {
+      uint8_t level = (x * 5 + y * 3 + seed) % 16;
+      if ((x + y + seed) % 4 == 0) level = 0;
+      uint8_t *row = &image[IMAGE_HEADERSIZE + y * stride];
+      if (bitsPerPixel == 4) row[x / 2] |= level << ((x & 1) ? 4 : 0);
+      else if (level & 1) row[x / 8] |= 0x80 >> (x % 8);
+    }
+  return image;
+}
+
+// Level of pixel x,y of a raw image, 0 is see-through
+static uint8_t spritePixel(const uint8_t *image, int x, int y) {
+  int width = image[1];
+  const uint8_t *row = image + IMAGE_HEADERSIZE;
+  if (image[0] == IMAGE_4BPP) {
+    row += y * ((width + 1) / 2);
+    return (x & 1) ? (row[x / 2] >> 4) : (row[x / 2] & 0x0F);
+  }
+  row += y * ((width + 7) / 8);
+  return (row[x / 8] & (0x80 >> (x % 8))) ? 15 : 0;
+}
+
+// What the sprite layer should show, kept apart from SSD1320_Sprites
+struct ReferenceSprite {
+  const uint8_t *image; // NULL when free
+  int x, y, z;
+  bool visible;
+};
+
+static ReferenceSprite spriteModel[SSD1320_SPRITE_COUNT];
+
+// Pixels of the panel that differ from the screen buffer with the sprites on top, by z then number
+static int countSpriteErrors(void) {
+  uint8_t *screen = flexibleOLED.getScreenBuffer();
+  int errors = 0;
+  for (int py = 0 ; py < SSD1320_HEIGHT ; py++)
+    for (int px = 0 ; px < SSD1320_WIDTH ; px++) {
+      uint8_t level = (screen[py * SSD1320_STRIDE + px / 8] & (0x80 >> (px % 8))) ? 15 : 0;
+      int shownZ = -1, shownNumber = -1;
+      for (int i = 0 ; i < SSD1320_SPRITE_COUNT ; i++) {
+        ReferenceSprite &sprite = spriteModel[i];
+        if (sprite.image == NULL || !sprite.visible) continue;
+        int sx = px - sprite.x, sy = py - sprite.y;
+        if (sx < 0 || sx >= sprite.image[1] || sy < 0 || sy >= sprite.image[2]) continue;
+        uint8_t pixel = spritePixel(sprite.image, sx, sy);
+        if (pixel == 0) continue;
+        if (sprite.z > shownZ || (sprite.z == shownZ && i > shownNumber)) {
+          level = pixel;
+          shownZ = sprite.z;
+          shownNumber = i;
+        }
+      }
+      if (panel.gdramPixel(px, py) != level) errors++;
+    }
+  return errors;
+}
+
+#ifdef SSD1320_ENABLE_STATS
+static int frameCallbacks = 0;
+
+static void countFrame(const SSD1320_Stats &stats) {
+  (void)stats;
+  frameCallbacks++;
+}
+#endif
+
+static void checkSprites(void) {
+  SSD1320_Sprites sprites(flexibleOLED);
+  std::vector<uint8_t> images[4] = {
+    makeSpriteImage(5, 4, 1, 0), makeSpriteImage(7, 6, 4, 1), makeSpriteImage(16, 9, 4, 2), makeSpriteImage(12, 12, 1, 3)
+  };
+  for (int i = 0 ; i < SSD1320_SPRITE_COUNT ; i++) spriteModel[i].image = NULL;
+
+  //Background
+  flexibleOLED.clearDisplay(CLEAR_ALL);
+  flexibleOLED.rect(0, 0, 160, 32);
+  flexibleOLED.rectFill(60, 8, 30, 16);
+  flexibleOLED.display();
+
+  const int places[][3] = {{10, 10, 0}, {14, 12, 1}, {50, 5, 0}, {100, 20, 2}};
+  int8_t numbers[4];
+  for (int i = 0 ; i < 4 ; i++) {
+    numbers[i] = sprites.add(images[i].data(), places[i][0], places[i][1], places[i][2]);
+    ReferenceSprite &model = spriteModel[numbers[i]];
+    model.image = images[i].data();
+    model.x = places[i][0];
+    model.y = places[i][1];
+    model.z = places[i][2];
+    model.visible = true;
+  }
+  sprites.redraw();
+  check(countSpriteErrors() == 0, "sprites redraw");
+
+  //Over the background and each other, and partly off the display
+  sprites.moveTo(numbers[0], 12, 13);
+  sprites.moveTo(numbers[2], 62, 10);
+  sprites.moveTo(numbers[3], 154, 26);
+  spriteModel[numbers[0]].x = 12, spriteModel[numbers[0]].y = 13;
+  spriteModel[numbers[2]].x = 62, spriteModel[numbers[2]].y = 10;
+  spriteModel[numbers[3]].x = 154, spriteModel[numbers[3]].y = 26;
+  panel.clearCounters();
+  sprites.flush();
+  check(countSpriteErrors() == 0 && panel.counters.dataBytes < SSD1320_WIDTH * SSD1320_HEIGHT / 2 / 4,
+        "sprites move, sending only what changed");
+
+  sprites.setZ(numbers[0], 5);
+  spriteModel[numbers[0]].z = 5;
+  sprites.flush();
+  check(countSpriteErrors() == 0, "sprites z order raised");
+  sprites.setZ(numbers[0], 1);
+  spriteModel[numbers[0]].z = 1;
+  sprites.flush();
+  check(countSpriteErrors() == 0, "sprites z order equal, pool order");
+
+  sprites.setVisible(numbers[1], false);
+  spriteModel[numbers[1]].visible = false;
+  sprites.flush();
+  check(countSpriteErrors() == 0, "sprites hide");
+  sprites.setVisible(numbers[1], true);
+  spriteModel[numbers[1]].visible = true;
+  sprites.flush();
+  check(countSpriteErrors() == 0, "sprites show");
+
+  sprites.setImage(numbers[1], images[2].data());
+  spriteModel[numbers[1]].image = images[2].data();
+  sprites.flush();
+  check(countSpriteErrors() == 0, "sprites new image");
+
+  sprites.remove(numbers[2]);
+  spriteModel[numbers[2]].image = NULL;
+  sprites.flush();
+  check(countSpriteErrors() == 0, "sprites remove");
+
+  //Changed background under and around the sprites
+  flexibleOLED.rectFill(8, 6, 20, 14, WHITE, XOR);
+  flexibleOLED.lineH(90, 22, 70);
+  sprites.invalidate(8, 6, 20, 14);
+  sprites.invalidate(90, 22, 70, 1);
+  sprites.flush();
+  check(countSpriteErrors() == 0, "sprites invalidate");
+
+  //Many frames of random changes
+  uint32_t seed = 1;
+  int bad = 0;
+  for (int frame = 0 ; frame < 500 ; frame++) {
+    for (int change = 0 ; change < 3 ; change++) {
+      seed = seed * 1103515245UL + 12345;
+      int i = (seed >> 8) % SSD1320_SPRITE_COUNT;
+      int value = seed >> 16;
+      ReferenceSprite &model = spriteModel[i];
+      switch ((seed >> 4) % 6) {
+        case 0:
+          if (model.image == NULL) {
+            const uint8_t *image = images[value % 4].data();
+            int8_t added = sprites.add(image, value % 170 - 8, (value >> 3) % 42 - 8, value % 3);
+            if (added >= 0) {
+              spriteModel[added].image = image;
+              spriteModel[added].x = value % 170 - 8;
+              spriteModel[added].y = (value >> 3) % 42 - 8;
+              spriteModel[added].z = value % 3;
+              spriteModel[added].visible = true;
+            }
+          } else {
+            sprites.remove(i);
+            model.image = NULL;
+          }
+          break;
+        case 1:
+          model.x += value % 7 - 3;
+          model.y += (value >> 4) % 5 - 2;
+          sprites.moveTo(i, model.x, model.y);
+          break;
+        case 2:
+          if (model.image != NULL) model.z = value % 3;
+          sprites.setZ(i, value % 3);
+          break;
+        case 3:
+          if (model.image != NULL) model.visible = !model.visible;
+          sprites.setVisible(i, model.visible);
+          break;
+        case 4:
+          if (model.image != NULL) model.image = images[value % 4].data();
+          sprites.setImage(i, images[value % 4].data());
+          break;
+        default: {
+          int x = value % 150, y = (value >> 4) % 28;
+          flexibleOLED.rectFill(x, y, 10, 4, WHITE, XOR);
+          sprites.invalidate(x, y, 10, 4);
+        }
+      }
+    }
+    sprites.flush();
+    if (countSpriteErrors() != 0) bad++;
+  }
+  check(bad == 0, "sprites 500 frames of random changes");
+
+#ifdef SSD1320_ENABLE_STATS
+  //A partial flush counts as a frame, a flush without changes doesn't
+  flexibleOLED.setFrameCallback(countFrame);
+  flexibleOLED.resetStats();
+  frameCallbacks = 0;
+  sprites.flush();
+  bool quiet = (flexibleOLED.getStats().framesFlushed == 0 && frameCallbacks == 0);
+  int8_t mover = sprites.add(images[0].data(), 40, 10);
+  sprites.flush();
+  sprites.moveTo(mover, 41, 10);
+  panel.clearCounters();
+  sprites.flush();
+  const SSD1320_Stats &stats = flexibleOLED.getStats();
+  check(quiet && stats.framesFlushed == 2 && frameCallbacks == 2 &&
+        stats.dirtyArea == panel.counters.dataBytes * 2 && stats.dirtyArea < SSD1320_WIDTH * SSD1320_HEIGHT,
+        "sprites flush updates the frame statistics");
+  flexibleOLED.setFrameCallback(NULL);
+#else
+  printf("%-56s %s\n", "sprites flush updates the frame statistics", "skipped, needs SSD1320_ENABLE_STATS");
+#endif
+}
+
+static uint32_t labelSeed = 1;
+
+static uint32_t nextRandom(void) {
+  labelSeed = labelSeed * 1103515245UL + 12345;
+  return labelSeed >> 8;
+}
+
+static void randomBuffer(void) {
+  uint8_t *screen = flexibleOLED.getScreenBuffer();
+  for (uint16_t i = 0 ; i < SSD1320_STRIDE * SSD1320_HEIGHT ; i++) screen[i] = nextRandom();
+}
+
+static void checkLabels(void) {
+  const uint16_t bufferSize = SSD1320_STRIDE * SSD1320_HEIGHT;
+  std::vector<uint8_t> before(bufferSize), reference(bufferSize);
+  uint8_t *screen = flexibleOLED.getScreenBuffer();
+  char what[64];
+
+  //drawBits() against setPixel() one pixel at a time, like drawChar() draws
+  for (uint8_t rotation = 0 ; rotation < 4 ; rotation++) {
+    flexibleOLED.setRotation(rotation);
+    int bad = 0;
+    for (int trial = 0 ; trial < 5000 ; trial++) {
+      uint8_t width = 1 + nextRandom() % 40, height = 1 + nextRandom() % 24;
+      uint8_t x = nextRandom() % 180, y = nextRandom() % 180;
+      if (nextRandom() % 4 == 0) x = 255 - nextRandom() % 16;
+      if (nextRandom() % 4 == 0) y = 255 - nextRandom() % 16;
+      uint8_t color = nextRandom() % 2 ? WHITE : BLACK, mode = nextRandom() % 2 ? XOR : NORM;
+      uint8_t stride = (width + 7) / 8;
+      std::vector<uint8_t> bits(stride * height);
+      for (size_t i = 0 ; i < bits.size() ; i++) bits[i] = nextRandom();
+
+      randomBuffer();
+      memcpy(before.data(), screen, bufferSize);
+      for (int r = 0 ; r < height && y + r <= 255 ; r++) //Pixels past 255 are dropped, not wrapped
+        for (int c = 0 ; c < width && x + c <= 255 ; c++) {
+          boolean set = bits[r * stride + c / 8] & (0x80 >> (c % 8));
+          flexibleOLED.setPixel(x + c, y + r, set ? color : !color, mode);
+        }
+      memcpy(reference.data(), screen, bufferSize);
+
+      memcpy(screen, before.data(), bufferSize);
+      flexibleOLED.drawBits(x, y, bits.data(), width, height, color, mode);
+      if (memcmp(screen, reference.data(), bufferSize) != 0) bad++;
+    }
+    snprintf(what, sizeof(what), "labels drawBits() = setPixel(), rotation %u", rotation);
+    check(bad == 0, what);
+  }
+
+  //Labels against print(), every font, rotation, color and mode, rendered and from the cache
+  const char *texts[] = {"TEMP", "RPM", "km/h", "0123", "Hello, world", "%", "+-*/=<>", "A"};
+  uint8_t pool[400];
+  SSD1320_Labels labels(flexibleOLED, pool, sizeof(pool));
+  uint8_t tiny[8];
+  SSD1320_Labels uncached(flexibleOLED, tiny, sizeof(tiny));
+  for (uint8_t font = 0 ; font < flexibleOLED.getTotalFonts() ; font++) {
+    if (!flexibleOLED.setFontType(font)) continue;
+    int bad = 0, cases = 0;
+    for (uint8_t rotation = 0 ; rotation < 4 ; rotation++) {
+      flexibleOLED.setRotation(rotation);
+      labels.clear();
+      for (int trial = 0 ; trial < 60 ; trial++) {
+        const char *text = texts[trial % 8];
+        uint16_t width = strlen(text) * (flexibleOLED.getFontWidth() + 1);
+        if (width > flexibleOLED.getDisplayWidth()) continue;
+        uint8_t x = nextRandom() % (flexibleOLED.getDisplayWidth() - width + 1);
+        uint8_t y = nextRandom() % flexibleOLED.getDisplayHeight();
+        uint8_t color = nextRandom() % 2 ? WHITE : BLACK, mode = nextRandom() % 2 ? XOR : NORM;
+
+        //print() leaves the column between characters of the tall fonts alone, a label
+        //draws it as background: compare those only where that draws nothing
+        boolean tall = flexibleOLED.getFontHeight() > 8;
+        if (tall) {
+          color = WHITE;
+          mode = NORM;
+          flexibleOLED.clearDisplay(CLEAR_BUFFER);
+        } else
+          randomBuffer();
+        memcpy(before.data(), screen, bufferSize);
+
+        flexibleOLED.setCursor(x, y);
+        flexibleOLED.setColor(color);
+        flexibleOLED.setDrawMode(mode);
+        flexibleOLED.print(text);
+        memcpy(reference.data(), screen, bufferSize);
+
+        memcpy(screen, before.data(), bufferSize);
+        labels.draw(x, y, text, color, mode);
+        if (memcmp(screen, reference.data(), bufferSize) != 0) bad++;
+
+        memcpy(screen, before.data(), bufferSize);
+        labels.draw(x, y, text, color, mode); //From the cache this time
+        if (memcmp(screen, reference.data(), bufferSize) != 0) bad++;
+
+        memcpy(screen, before.data(), bufferSize);
+        if (uncached.draw(x, y, text, color, mode)) bad++; //Too big for the pool, drawn with drawChar()
+        if (memcmp(screen, reference.data(), bufferSize) != 0) bad++;
+        cases += 3;
+      }
+    }
+    snprintf(what, sizeof(what), "labels draw() = print(), font %u, %d cases", font, cases);
+    check(bad == 0, what);
+  }
+  flexibleOLED.setRotation(0);
+  flexibleOLED.setFontType(0);
+  flexibleOLED.setColor(WHITE);
+  flexibleOLED.setDrawMode(NORM);
+}
+
+// Reference player for the animation format in SSD1320_Animation.h, into a plain array of levels
+struct ReferenceAnimation {
+  const uint8_t *data, *spot;
+  uint8_t format, width, height;
+  uint16_t frames;
+  uint8_t levels[SSD1320_HEIGHT][SSD1320_WIDTH];
+  int x, y;
+
+  void begin(const uint8_t *animation, int left, int bottom) {
+    data = animation;
+    format = data[0];
+    width = data[1];
+    height = data[2];
+    frames = data[3] | data[4] << 8;
+    spot = data + ANIMATION_HEADERSIZE;
+    memset(levels, 0, sizeof(levels));
+    x = left;
+    y = bottom;
+  }
+
+  void restart(void) {
+    spot = data + ANIMATION_HEADERSIZE;
+  }
+
+  void drawFrame(void) {
+    int pixelsPerByte = (format == IMAGE_4BPP) ? 2 : 8;
+    int rectangles = *spot++;
+    for (int i = 0 ; i < rectangles ; i++) {
+      int rx = spot[0], ry = spot[1], rw = spot[2], rh = spot[3];
+      spot += 4;
+
+      std::vector<uint8_t> bytes;
+      while ((int)bytes.size() < rw * rh) {
+        uint8_t n = *spot++;
+        if (n == 128) continue;
+        if (n > 128) {
+          bytes.insert(bytes.end(), 257 - n, *spot++);
+        } else {
+          bytes.insert(bytes.end(), spot, spot + n + 1);
+          spot += n + 1;
+        }
+      }
+
+      for (int r = 0 ; r < rh ; r++)
+        for (int b = 0 ; b < rw ; b++)
+          for (int p = 0 ; p < pixelsPerByte ; p++) {
+            int px = x + (rx + b) * pixelsPerByte + p, py = y + ry + r;
+            if (px >= SSD1320_WIDTH || py >= SSD1320_HEIGHT) continue;
+            uint8_t byte = bytes[r * rw + b];
+            if (format == IMAGE_4BPP)
+              levels[py][px] = (p == 0) ? (byte & 0x0F) : (byte >> 4);
+            else
+              levels[py][px] = (byte & (0x80 >> p)) ? 15 : 0;
+          }
+    }
+  }
+
+  bool matches(void) {
+    for (int py = 0 ; py < SSD1320_HEIGHT ; py++)
+      for (int px = 0 ; px < SSD1320_WIDTH ; px++)
+        if (panel.gdramPixel(px, py) != levels[py][px]) return false;
+    return true;
+  }
+};
+
+static ReferenceAnimation reference;
+
+// Draw frames with update() and count the ones that differ from the reference player.
+// Stores the panel checksum of each frame in sums when given.
+static int playAndCompare(SSD1320_Animation &animation, int count, uint32_t *sums = NULL) {
+  int bad = 0;
+  for (int frame = 0 ; frame < count ; frame++) {
+    if (!animation.update()) return bad + count - frame;
+    if (frame % reference.frames == 0 && frame > 0) reference.restart();
+    reference.drawFrame();
+    if (!reference.matches()) bad++;
+    if (sums != NULL) sums[frame] = panel.frameChecksum();
+  }
+  return bad;
+}
+
+static void checkAnimation(void) {
+  SSD1320_Animation animation(flexibleOLED);
+  uint16_t frames = bootAnimation[3] | bootAnimation[4] << 8;
+  std::vector<uint32_t> sums(frames), streamSums(frames);
+  char what[64];
+
+  //Played once from PROGMEM, then it stops
+  flexibleOLED.clearDisplay(CLEAR_ALL);
+  animation.begin(bootAnimation);
+  animation.setFrameRate(0);
+  reference.begin(bootAnimation, 0, 0);
+  int bad = playAndCompare(animation, frames, sums.data());
+  snprintf(what, sizeof(what), "animation from PROGMEM, %u frames", frames);
+  check(bad == 0 && !animation.update() && animation.getFrame() == frames, what);
+
+  //Moved up and right, clipped at the edges of the display
+  flexibleOLED.clearDisplay(CLEAR_ALL);
+  animation.begin(bootAnimation, 38, 11);
+  animation.setFrameRate(0);
+  reference.begin(bootAnimation, 38, 11);
+  check(playAndCompare(animation, frames) == 0, "animation at 38,11 clipped");
+
+  //Looping starts over at the first frame
+  flexibleOLED.clearDisplay(CLEAR_ALL);
+  animation.begin(bootAnimation);
+  animation.setFrameRate(0);
+  animation.setLoop(true);
+  reference.begin(bootAnimation, 0, 0);
+  bad = playAndCompare(animation, 2 * frames + 5);
+  check(bad == 0 && animation.getFrame() == 5, "animation loops twice and a bit");
+
+  //From a Stream the frames are the same, and looping is ignored
+  flexibleOLED.clearDisplay(CLEAR_ALL);
+  HostMemoryStream stream(bootAnimation, sizeof(bootAnimation));
+  stream.setTimeout(1);
+  animation.begin(stream);
+  animation.setFrameRate(0);
+  animation.setLoop(true);
+  reference.begin(bootAnimation, 0, 0);
+  bad = playAndCompare(animation, frames, streamSums.data());
+  check(bad == 0 && sums == streamSums && !animation.update() && stream.bytesRead == sizeof(bootAnimation),
+        "animation from a Stream, same frame checksums");
+
+  //A stream cut short in the middle of a frame stops playing there
+  flexibleOLED.clearDisplay(CLEAR_ALL);
+  HostMemoryStream cut(bootAnimation, sizeof(bootAnimation));
+  cut.limit = sizeof(bootAnimation) / 2;
+  cut.setTimeout(1);
+  animation.begin(cut);
+  animation.setFrameRate(0);
+  reference.begin(bootAnimation, 0, 0);
+  int shown = 0;
+  bad = 0;
+  while (shown < frames && animation.update()) {
+    reference.drawFrame();
+    if (panel.frameChecksum() != sums[shown] || !reference.matches()) bad++;
+    shown++;
+  }
+  snprintf(what, sizeof(what), "animation cut short stops after %d frames", shown);
+  check(bad == 0 && shown > 0 && shown < frames && animation.getFrame() == shown && !animation.update(), what);
+
+  //A rectangle wider than a display row stops playing at once
+  std::vector<uint8_t> damaged(bootAnimation, bootAnimation + sizeof(bootAnimation));
+  damaged[ANIMATION_HEADERSIZE + 1 + 2] = SSD1320_WIDTH / 2 + 1; //Width of the first rectangle
+  animation.begin(damaged.data());
+  animation.setFrameRate(0);
+  check(!animation.update() && animation.getFrame() == 0 && !animation.update(), "animation with a damaged frame stops");
+
+  //A frame rate set before begin() is kept, so every update() draws a frame
+  SSD1320_Animation fast(flexibleOLED);
+  fast.setFrameRate(0);
+  fast.begin(bootAnimation);
+  for (int frame = 0 ; frame < frames ; frame++)
+    fast.update();
+  check(fast.getFrame() == frames, "animation keeps a frame rate set before begin()");
+}
+
+// Run a pulse for a few periods, one millisecond per update(), and track the contrast sent
+static void checkPulse(uint8_t low, uint8_t high, uint16_t period) {
+  char what[80];
+  uint8_t lowest = 255, highest = 0;
+
+  flexibleOLED.pulse(low, high, period);
+  for (int step = 0 ; step < period * 20 ; step++) {
+    delay(1);
+    flexibleOLED.update();
+    if (panel.contrast < lowest) lowest = panel.contrast;
+    if (panel.contrast > highest) highest = panel.contrast;
+  }
+  flexibleOLED.stopTransition();
+
+  snprintf(what, sizeof(what), "pulse %d to %d, %d ms period stays in range", low, high, period);
+  check(lowest == low && highest == high, what);
+}
+
+static void checkTransitions(void) {
+  uint8_t contrast = panel.contrast;
+  checkPulse(100, 200, 4);
+  checkPulse(100, 200, 5);
+  checkPulse(100, 200, 3);
+  checkPulse(20, 220, 7);
+  checkPulse(50, 60, 1000);
+  flexibleOLED.setContrast(contrast);
+}
+
+struct Check {
+  const char *name;
+  void (*run)(void);
+};
+
+static const Check checks[] = {
+  {"bmp", checkBMP},
+  {"scaler", checkScaler},
+  {"animation", checkAnimation},
+  {"sprites", checkSprites},
+  {"labels", checkLabels},
+  {"transitions", checkTransitions},
+};
+
+#define TOTALCHECKS (sizeof(checks) / sizeof(checks[0]))
+
+int main(int argc, char **argv) {
+  flexibleOLED.begin(160, 32);
+
+  for (size_t c = 0 ; c < TOTALCHECKS ; c++) {
+    bool wanted = (argc < 2);
+    for (int x = 1 ; x < argc ; x++)
+      if (strcmp(argv[x], checks[c].name) == 0) wanted = true;
+    if (wanted) checks[c].run();
+  }
+
+  printf("%d failed\n", failures);
+  return failures ? 1 : 0;
+}
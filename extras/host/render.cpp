@@ -0,0 +1,51 @@
+/*
+  Render a test scene through the library and the virtual SSD1320.
+
+  Draws the 'hello world' screen from Example1_Text plus a few shapes, writes what the
+  panel would show to a PGM file and prints the bus cost of each step.
+
+  See README.md in this folder for how to build it.
+*/
+
+#include <SSD1320_OLED.h>
+#include "VirtualSSD1320.h"
+
+VirtualSSD1320 panel(10, 9, 13, 11);
+SSD1320 flexibleOLED(10, 9); //10 = CS, 9 = RES
+
+static void report(const char *step) {
+  VirtualSSD1320Counters &c = panel.counters;
+  printf("%-14s cs=%-6lu pins=%-7lu spi=%-6lu cmd=%-5lu data=%-6lu nop=%lu\n", step,
+         c.csToggles, c.pinToggles, c.spiBytes, c.commandBytes, c.dataBytes, c.nops);
+  panel.clearCounters();
+}
+
+int main(int argc, char **argv) {
+  const char *path = (argc > 1) ? argv[1] : "frame.pgm";
+
+  flexibleOLED.begin(160, 32); //Display is 160 wide, 32 high
+  report("begin");
+
+  flexibleOLED.clearDisplay(); //Clear display and buffer
+  report("clearDisplay");
+
+  flexibleOLED.setFontType(1); //Large font
+  flexibleOLED.setCursor(28, 12);
+  flexibleOLED.print("Hello World!");
+  flexibleOLED.setFontType(0); //Small font
+  flexibleOLED.setCursor(52, 0);
+  flexibleOLED.print("8:45:03 AM");
+  flexibleOLED.rect(0, 0, 20, 12);
+  flexibleOLED.circleFill(150, 22, 6);
+  report("draw");
+
+  flexibleOLED.display();
+  report("display");
+
+  if (!panel.dumpPGM(path)) {
+    printf("Could not write %s\n", path);
+    return 1;
+  }
+  printf("Wrote %s, checksum %08lX\n", path, (unsigned long)panel.frameChecksum());
+  return 0;
+}
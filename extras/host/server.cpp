@@ -0,0 +1,147 @@
+/*
+  Drive a virtual SSD1320 through SSD1320_Server over a pair of pipes.
+
+  The host half records each frame with SSD1320_DisplayList, wraps it in a server frame and
+  writes it into one pipe. The display half runs SSD1320_Server on the other end and draws
+  onto the virtual panel. Every frame is compared with drawing the same scene directly. A
+  damaged frame must be NAKed and a resent frame must not be drawn twice. Exits with 1 on
+  any mismatch.
+
+  Usage: server [frame.pgm]
+  See README.md in this folder for how to build it.
+*/
+
+#include <SSD1320_OLED.h>
+#include <SSD1320_DisplayList.h>
+#include <SSD1320_Server.h>
+#include "VirtualSSD1320.h"
+#include "HostPipeStream.h"
+
+VirtualSSD1320 panel(10, 9, 13, 11);
+SSD1320 flexibleOLED(10, 9); //10 = CS, 9 = RES
+
+static int failures = 0;
+
+static void check(bool ok, const char *what) {
+  printf("%-48s %s\n", what, ok ? "ok" : "FAILED");
+  if (!ok) failures++;
+}
+
+// Host side: frame a payload and send it, then let the display side run and read its reply
+static bool transact(HostPipeStream &host, SSD1320_Server &server, uint8_t sequence,
+                     const uint8_t *payload, uint8_t length, bool damage,
+                     uint8_t *status, uint8_t *data, uint8_t *dataLength) {
+  uint8_t crc = SSD1320_Server::crc8(SSD1320_Server::crc8(0, sequence), length);
+  for (uint8_t x = 0 ; x < length ; x++) crc = SSD1320_Server::crc8(crc, payload[x]);
+  if (damage) crc ^= 0x01;
+
+  host.write(SERVER_SYNC);
+  host.write(sequence);
+  host.write(length);
+  host.write(payload, length);
+  host.write(crc);
+
+  server.update();
+
+  uint8_t reply[4 + SERVER_REPLY_DATA + 1];
+  uint8_t got = 0;
+  while (host.available() && got < sizeof(reply)) reply[got++] = host.read();
+  if (got < 5 || reply[0] != SERVER_SYNC || reply[1] != sequence) return false;
+
+  uint8_t replyCrc = 0;
+  for (uint8_t x = 1 ; x < got - 1 ; x++) replyCrc = SSD1320_Server::crc8(replyCrc, reply[x]);
+  if (replyCrc != reply[got - 1] || got != 5 + reply[3]) return false;
+
+  *status = reply[2];
+  *dataLength = reply[3];
+  memcpy(data, reply + 4, reply[3]);
+  return true;
+}
+
+// One frame of the test scene, recorded or drawn directly
+template <class Target> static void scene(Target &target, uint8_t frame) {
+  target.clearDisplay(CLEAR_BUFFER);
+  target.setFontType(0);
+  target.rect(0, 0, 160, 32);
+  target.circleFill(20 + frame * 12, 16, 6);
+  target.setCursor(100, 12);
+  target.print("Frame ");
+  target.print(frame);
+  target.display();
+}
+
+int main(int argc, char **argv) {
+  int toDisplay[2], toHost[2];
+  if (pipe(toDisplay) != 0 || pipe(toHost) != 0) {
+    perror("pipe");
+    return 2;
+  }
+  HostPipeStream host(toHost[0], toDisplay[1]);
+  HostPipeStream port(toDisplay[0], toHost[1]);
+
+  flexibleOLED.begin(160, 32);
+  SSD1320_Server server(flexibleOLED, port);
+
+  uint8_t listBuffer[SSD1320_SERVER_BUFFER];
+  SSD1320_DisplayList list(listBuffer, sizeof(listBuffer));
+  uint8_t status, data[SERVER_REPLY_DATA], dataLength;
+  uint8_t sequence = 0;
+  bool ok;
+
+  // Queries
+  uint8_t query[] = {CMD_GETLCDWIDTH, CMD_GETLCDHEIGHT};
+  ok = transact(host, server, ++sequence, query, sizeof(query), false, &status, data, &dataLength);
+  check(ok && status == SERVER_ACK && dataLength == 4 && data[0] == 160 && data[1] == 0 && data[2] == 32,
+        "width and height queries");
+
+  // Frames drawn through the server match frames drawn directly
+  const uint8_t frames = 10;
+  unsigned long sentBefore = host.bytesWritten;
+  bool allMatch = true;
+  for (uint8_t frame = 0 ; frame < frames ; frame++) {
+    list.reset();
+    scene(list, frame);
+    ok = transact(host, server, ++sequence, list.getBuffer(), list.length(), false, &status, data, &dataLength);
+    uint32_t served = panel.frameChecksum();
+
+    scene(flexibleOLED, frame);
+    if (!ok || status != SERVER_ACK || served != panel.frameChecksum()) allMatch = false;
+  }
+  unsigned long sent = host.bytesWritten - sentBefore;
+  check(allMatch, "frames match direct drawing");
+  printf("%u frames took %lu bytes on the link, %u as raw GDRAM data (%.1f%%)\n", frames, sent,
+         frames * 2560, 100.0 * sent / (frames * 2560));
+
+  // A damaged frame is refused and nothing is drawn
+  unsigned long drawn = server.getFrames();
+  list.reset();
+  scene(list, 3);
+  ok = transact(host, server, ++sequence, list.getBuffer(), list.length(), true, &status, data, &dataLength);
+  check(ok && status == SERVER_NAK && server.getFrames() == drawn, "damaged frame is NAKed");
+
+  // The resend is drawn, a second resend is only acknowledged
+  ok = transact(host, server, sequence, list.getBuffer(), list.length(), false, &status, data, &dataLength);
+  check(ok && status == SERVER_ACK && server.getFrames() == drawn + 1, "resend after NAK is drawn");
+  ok = transact(host, server, sequence, list.getBuffer(), list.length(), false, &status, data, &dataLength);
+  check(ok && status == SERVER_ACK && server.getFrames() == drawn + 1, "duplicate frame is not drawn twice");
+
+  // An unknown command refuses the whole batch
+  uint8_t bad[] = {CMD_PIXEL, 1, 1, 0x7F};
+  ok = transact(host, server, ++sequence, bad, sizeof(bad), false, &status, data, &dataLength);
+  check(ok && status == SERVER_NAK, "unknown command is NAKed");
+
+  // Partial screen buffer update
+  uint8_t blit[5 + 2 * 8] = {CMD_DRAWBITMAP, 4, 8, 2, 8};
+  for (uint8_t x = 0 ; x < 16 ; x++) blit[5 + x] = (x & 1) ? 0x0F : 0xF0;
+  uint8_t show[] = {CMD_DISPLAY};
+  flexibleOLED.clearDisplay(CLEAR_BUFFER);
+  ok = transact(host, server, ++sequence, blit, sizeof(blit), false, &status, data, &dataLength) && status == SERVER_ACK;
+  ok = ok && transact(host, server, ++sequence, show, sizeof(show), false, &status, data, &dataLength) && status == SERVER_ACK;
+  check(ok && panel.pixel(32, 31 - 8) == 15 && panel.pixel(36, 31 - 8) == 0 && panel.pixel(44, 31 - 9) == 15,
+        "partial screen buffer update");
+
+  if (argc > 1) panel.dumpPGM(argv[1]);
+
+  printf("%d failures, %lu frames drawn, %lu errors\n", failures, server.getFrames(), server.getErrors());
+  return failures ? 1 : 0;
+}
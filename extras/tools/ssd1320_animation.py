@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+"""
+Turn a sequence of pictures into a delta frame animation for SSD1320_Animation.
+
+Each frame after the first only stores the rectangles that changed, PackBits compressed.
+See src/SSD1320_Animation.h for the format. Frames are read like ssd1320_image.py reads
+images (.bmp or .pgm) and must all be the same size.
+
+Examples:
+  ssd1320_animation.py --fps 20 frames/*.bmp -o boot.h
+  ssd1320_animation.py --bits 4 --dither floyd --fps 12 frame*.pgm -o intro.h
+
+Only the Python standard library is needed.
+"""
+
+import argparse
+import os
+import sys
+
+sys.dont_write_bytecode = True
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from ssd1320_image import IMAGE_1BPP, IMAGE_4BPP, MAX_WIDTH, fail, pack_rows, packbits, quantize, read_bmp, read_pgm
+
+GAP = 4  # Unchanged bytes or rows worth bridging rather than starting another rectangle
+
+
+def read_frame(path, bits, dither):
+    with open(path, "rb") as f:
+        data = f.read()
+    extension = os.path.splitext(path)[1].lower()
+    if extension == ".bmp":
+        width, height, rows = read_bmp(data)
+    elif extension == ".pgm":
+        width, height, rows = read_pgm(data)
+    else:
+        fail("don't know how to read " + path)
+    pixels = pack_rows(quantize(rows, 1 << bits, dither), bits)
+    stride = len(pixels) // height
+    return width, height, [pixels[y * stride:(y + 1) * stride] for y in range(height)]
+
+
+def spans(flags):
+    """Ranges [start, end) of set flags, bridging gaps up to GAP long."""
+    out = []
+    for i, flag in enumerate(flags):
+        if not flag:
+            continue
+        if out and i - out[-1][1] <= GAP:
+            out[-1][1] = i + 1
+        else:
+            out.append([i, i + 1])
+    return out
+
+
+def changed_rectangles(before, after):
+    """Rectangles (x, y, width, height) in bytes and rows that cover every change."""
+    stride = len(after[0])
+    rectangles = []
+    for top, bottom in spans([before[y] != after[y] for y in range(len(after))]):
+        changed = [any(before[y][x] != after[y][x] for y in range(top, bottom)) for x in range(stride)]
+        for left, right in spans(changed):
+            rows = [y for y in range(top, bottom) if before[y][left:right] != after[y][left:right]]
+            rectangles.append((left, rows[0], right - left, rows[-1] + 1 - rows[0]))
+    return rectangles
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Make a delta frame SSD1320 animation.")
+    parser.add_argument("frames", nargs="+", help="frames in order, .bmp or .pgm")
+    parser.add_argument("-o", "--output", help="header file to write, default stdout")
+    parser.add_argument("--name", default="animation", help="array name (default animation)")
+    parser.add_argument("--bits", type=int, choices=(1, 4), default=1, help="bits per pixel (default 1)")
+    parser.add_argument("--dither", choices=("none", "bayer", "floyd"), default="none",
+                        help="how to bring gray down to 16 or 2 levels (default none)")
+    parser.add_argument("--fps", type=float, default=20, help="frames per second (default 20)")
+    args = parser.parse_args()
+
+    frames = [read_frame(path, args.bits, args.dither) for path in args.frames]
+    width, height = frames[0][0], frames[0][1]
+    if any(f[0] != width or f[1] != height for f in frames):
+        fail("all frames must be the same size")
+    if width > MAX_WIDTH or height > 255 or len(frames) > 0xFFFF:
+        fail("%dx%d is too big, at most %d wide and 255 high" % (width, height, MAX_WIDTH))
+
+    frame_time = int(round(1000 / args.fps))
+    image_format = IMAGE_4BPP if args.bits == 4 else IMAGE_1BPP
+    animation = bytearray([image_format, width, height, len(frames) & 0xFF, len(frames) >> 8,
+                           frame_time & 0xFF, frame_time >> 8])
+
+    stride = len(frames[0][2][0])
+    sent = 0  # Bytes of pixel data each play sends over SPI, before 1-bit expansion
+    previous = None
+    for _, _, rows in frames:
+        # The first frame covers everything so the animation can start over on any screen
+        rectangles = [(0, 0, stride, height)] if previous is None else changed_rectangles(previous, rows)
+        if len(rectangles) > 255:
+            fail("too many changes in one frame")
+        animation.append(len(rectangles))
+        for x, y, w, h in rectangles:
+            animation += bytes([x, y, w, h])
+            animation += packbits(b"".join(rows[row][x:x + w] for row in range(y, y + h)))
+            sent += w * h
+        previous = rows
+
+    full = stride * height * len(frames)
+    lines = ["/* Made by extras/tools/ssd1320_animation.py from %d frames" % len(frames),
+             "   %dx%d, %d bits per pixel, %d ms per frame: %d bytes (%d as full frames). See SSD1320_Animation.h */" %
+             (width, height, args.bits, frame_time, len(animation), full),
+             "",
+             "static const uint8_t %s[%d] PROGMEM = {" % (args.name, len(animation))]
+    for spot in range(0, len(animation), 16):
+        lines.append("  " + ", ".join("0x%02x" % b for b in animation[spot:spot + 16]) + ",")
+    lines.append("};")
+    text = "\n".join(lines) + "\n"
+
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+    sys.stderr.write("%s: %d frames, %d bytes (%d as full frames), %d of %d pixel bytes sent per play\n" %
+                     (args.name, len(frames), len(animation), full, sent, full))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,245 @@
+#!/usr/bin/env python3
+"""
+Convert a picture into a compressed image for the SSD1320 library.
+
+The output is a header file with one PROGMEM array that SSD1320::displayImage() and
+SSD1320::drawImage() take. See src/SSD1320_Image.h for the format.
+
+Inputs:
+  .bmp  Uncompressed BMP, 1, 4, 8 or 24 bits per pixel, bottom-up or top-down
+  .pgm  Binary (P5) PGM
+  .h    A raw 4 bit GDRAM array like examples/Example2_Graphics/che.h. Give --width and
+        --height if it isn't 160x32.
+
+Examples:
+  ssd1320_image.py logo.bmp -o logo.h
+  ssd1320_image.py --bits 1 --dither floyd photo.bmp -o photo.h
+  ssd1320_image.py ../../examples/Example2_Graphics/che.h --name che -o che_packed.h
+
+Only the Python standard library is needed.
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+IMAGE_1BPP = 0x01
+IMAGE_4BPP = 0x04
+IMAGE_PACKBITS = 0x80
+MAX_WIDTH = 160
+
+BAYER4X4 = [0, 8, 2, 10, 12, 4, 14, 6, 3, 11, 1, 9, 15, 7, 13, 5]
+
+
+def fail(message):
+    sys.exit("ssd1320_image: " + message)
+
+
+def luminance(red, green, blue):
+    return (red * 77 + green * 150 + blue * 29) >> 8
+
+
+def read_bmp(data):
+    """Returns width, height and rows of 8 bit gray, bottom row first."""
+    if data[:2] != b"BM":
+        fail("not a BMP")
+    offset, header_size = struct.unpack_from("<II", data, 10)
+    if header_size < 40:
+        fail("OS/2 BMPs are not supported")
+    width, height, planes, bits, compression, _, _, _, colors_used = struct.unpack_from("<iiHHIIiiI", data, 18)
+    if compression != 0 or bits not in (1, 4, 8, 24):
+        fail("only uncompressed 1, 4, 8 and 24 bit BMPs are supported")
+
+    palette = []
+    if bits <= 8:
+        colors = colors_used or (1 << bits)
+        spot = 14 + header_size
+        for i in range(colors):
+            blue, green, red = data[spot + i * 4:spot + i * 4 + 3]
+            palette.append(luminance(red, green, blue))
+
+    top_down = height < 0
+    height = abs(height)
+    stride = (width * bits + 31) // 32 * 4
+    rows = []
+    for row in range(height):
+        line = data[offset + row * stride:offset + (row + 1) * stride]
+        if bits == 24:
+            gray = [luminance(line[x * 3 + 2], line[x * 3 + 1], line[x * 3]) for x in range(width)]
+        else:
+            gray = []
+            for x in range(width):
+                bit = x * bits
+                index = (line[bit // 8] >> (8 - bits - bit % 8)) & ((1 << bits) - 1)
+                gray.append(palette[index])
+        rows.append(gray)
+    if top_down:
+        rows.reverse()
+    return width, height, rows
+
+
+def read_pgm(data):
+    fields = re.match(rb"P5\s+(?:#.*\s+)*(\d+)\s+(\d+)\s+(\d+)\s", data)
+    if not fields:
+        fail("only binary (P5) PGMs are supported")
+    width, height, maximum = (int(f) for f in fields.groups())
+    pixels = data[fields.end():]
+    rows = [[pixels[y * width + x] * 255 // maximum for x in range(width)] for y in range(height)]
+    rows.reverse()  # PGM is top-down
+    return width, height, rows
+
+
+def read_array(text, width, height):
+    values = [int(v, 16) for v in re.findall(r"0x([0-9a-fA-F]{1,2})", text.split("{", 1)[1])]
+    stride = (width + 1) // 2
+    if len(values) < stride * height:
+        fail("array has %d bytes, %dx%d needs %d" % (len(values), width, height, stride * height))
+    rows = []
+    for y in range(height):
+        line = values[y * stride:(y + 1) * stride]
+        rows.append([((line[x // 2] >> 4) if x & 1 else (line[x // 2] & 0x0F)) * 17 for x in range(width)])
+    return width, height, rows
+
+
+def quantize(rows, levels, dither):
+    """Brings 8 bit gray down to levels, like SSD1320_Dither."""
+    steps = levels - 1
+    out = []
+    errors = [0] * (len(rows[0]) + 2)
+    for y, row in enumerate(rows):
+        right = below_right = 0
+        line = []
+        for x, gray in enumerate(row):
+            value = gray
+            if dither == "bayer":
+                value += (BAYER4X4[(y & 3) * 4 + (x & 3)] * 2 - 15) * (255 // steps) // 32
+            elif dither == "floyd":
+                value += right + errors[x + 1]
+            value = max(0, min(255, value))
+            level = (value * steps + 127) // 255
+            if dither == "floyd":
+                error = value - level * 255 // steps
+                right = int(error * 7 / 16)
+                errors[x] += int(error * 3 / 16)
+                errors[x + 1] = below_right + int(error * 5 / 16)
+                below_right = int(error / 16)
+            line.append(level)
+        out.append(line)
+    return out
+
+
+def pack_rows(levels, bits):
+    data = bytearray()
+    for row in levels:
+        if bits == 4:
+            row = row + [0] * (len(row) & 1)
+            data += bytes(row[x] | (row[x + 1] << 4) for x in range(0, len(row), 2))
+        else:
+            row = row + [0] * (-len(row) % 8)
+            for x in range(0, len(row), 8):
+                data.append(sum(1 << (7 - i) for i in range(8) if row[x + i]))
+    return bytes(data)
+
+
+def packbits(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and data[i + run] == data[i] and run < 128:
+            run += 1
+        if run >= 3:
+            out += bytes([257 - run, data[i]])
+            i += run
+            continue
+
+        start = i
+        while i < len(data) and i - start < 128:
+            if i + 2 < len(data) and data[i] == data[i + 1] == data[i + 2]:
+                break
+            i += 1
+        out.append(i - start - 1)
+        out += data[start:i]
+    return bytes(out)
+
+
+def unpackbits(data, length):
+    out = bytearray()
+    i = 0
+    while len(out) < length:
+        n = data[i]
+        i += 1
+        if n < 128:
+            out += data[i:i + n + 1]
+            i += n + 1
+        elif n > 128:
+            out += bytes([data[i]]) * (257 - n)
+            i += 1
+    return bytes(out[:length])
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert a picture into a compressed SSD1320 image.")
+    parser.add_argument("input", help=".bmp, .pgm or raw 4 bit .h array")
+    parser.add_argument("-o", "--output", help="header file to write, default stdout")
+    parser.add_argument("--name", help="array name, default from the input file name")
+    parser.add_argument("--bits", type=int, choices=(1, 4), default=4, help="bits per pixel (default 4)")
+    parser.add_argument("--dither", choices=("none", "bayer", "floyd"), default="none",
+                        help="how to bring gray down to 16 or 2 levels (default none)")
+    parser.add_argument("--raw", action="store_true", help="don't compress")
+    parser.add_argument("--width", type=int, default=160, help="width of a .h array (default 160)")
+    parser.add_argument("--height", type=int, default=32, help="height of a .h array (default 32)")
+    args = parser.parse_args()
+
+    with open(args.input, "rb") as f:
+        data = f.read()
+    extension = os.path.splitext(args.input)[1].lower()
+    if extension == ".bmp":
+        width, height, rows = read_bmp(data)
+    elif extension == ".pgm":
+        width, height, rows = read_pgm(data)
+    elif extension == ".h":
+        width, height, rows = read_array(data.decode("latin-1"), args.width, args.height)
+    else:
+        fail("don't know how to read " + args.input)
+
+    if width > MAX_WIDTH or height > 255:
+        fail("%dx%d is too big, at most %d wide and 255 high" % (width, height, MAX_WIDTH))
+
+    pixels = pack_rows(quantize(rows, 1 << args.bits, args.dither), args.bits)
+    packed = packbits(pixels)
+    assert unpackbits(packed, len(pixels)) == pixels
+
+    image_format = IMAGE_4BPP if args.bits == 4 else IMAGE_1BPP
+    if not args.raw and len(packed) < len(pixels):
+        image_format |= IMAGE_PACKBITS
+        body = packed
+    else:
+        body = pixels
+    image = bytes([image_format, width, height]) + body
+
+    name = args.name or re.sub(r"\W", "_", os.path.splitext(os.path.basename(args.input))[0])
+    lines = ["/* Made by extras/tools/ssd1320_image.py from %s" % os.path.basename(args.input),
+             "   %dx%d, %d bits per pixel, %s: %d bytes (%d raw). See SSD1320_Image.h */" %
+             (width, height, args.bits, "PackBits" if image_format & IMAGE_PACKBITS else "uncompressed",
+              len(image), len(pixels)),
+             "",
+             "static const uint8_t %s[%d] PROGMEM = {" % (name, len(image))]
+    for spot in range(0, len(image), 16):
+        lines.append("  " + ", ".join("0x%02x" % b for b in image[spot:spot + 16]) + ",")
+    lines.append("};")
+    text = "\n".join(lines) + "\n"
+
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+    sys.stderr.write("%s: %dx%d, %d bytes raw, %d bytes as written (%.1fx)\n" %
+                     (name, width, height, len(pixels), len(image), len(pixels) / float(len(image))))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,227 @@
+/*
+  Delta frame animation player for the SSD1320 driver. See SSD1320_Animation.h.
+*/
+
+#include "SSD1320_Animation.h"
+
+/** \brief Animation player constructor.
+    Frames are drawn onto oled. Call begin() on it first.
+*/
+SSD1320_Animation::SSD1320_Animation(SSD1320 &oled) {
+  _oled = &oled;
+  _animation = NULL;
+  _source = NULL;
+  _frames = 0;
+  _frame = 0;
+  _loop = false;
+  _playing = false;
+  _frameRateSet = false;
+}
+
+/** \brief Start a PROGMEM animation.
+    animation is made by extras/tools/ssd1320_animation.py. Its bottom left corner goes at
+    x,y, x is rounded down to an even column. Returns false if the header isn't valid.
+*/
+boolean SSD1320_Animation::begin(const uint8_t *animation, uint8_t x, uint8_t y) {
+  _animation = animation;
+  _spot = animation;
+  _source = NULL;
+  _x = x & ~1;
+  _y = y;
+  return readHeader();
+}
+
+/** \brief Start an animation from a Stream.
+    As begin() above, the animation is read from source as it plays. source's setTimeout()
+    sets how long to wait for each byte. A Stream can't be rewound, so setLoop() is ignored.
+*/
+boolean SSD1320_Animation::begin(Stream &source, uint8_t x, uint8_t y) {
+  _animation = NULL;
+  _source = &source;
+  _x = x & ~1;
+  _y = y;
+  return readHeader();
+}
+
+/** \brief Play.
+    Draw the next frame if it is due. Returns true while the animation plays, false once
+    the last frame has been shown for its frame time, the stream ran dry or a frame is
+    damaged (a rectangle wider than a display row).
+*/
+boolean SSD1320_Animation::update(void) {
+  if (!_playing) return false;
+
+  unsigned long now = millis();
+  if ((long)(now - _due) < 0) return true;
+
+  if (_frame == _frames)
+  {
+    if (!_loop || _animation == NULL)
+    {
+      _playing = false;
+      return false;
+    }
+    _spot = _animation + ANIMATION_HEADERSIZE;
+    _frame = 0;
+  }
+
+  if (!drawFrame())
+  {
+    _playing = false;
+    return false;
+  }
+  _frame++;
+
+  //Keep to the frame rate. After a stall start again from now rather than rushing frames.
+  if (now - _due >= _frameTime) _due = now + _frameTime;
+  else _due += _frameTime;
+  return true;
+}
+
+/** \brief Play to the end.
+    Call update() until the animation is over. Never returns when looping.
+*/
+void SSD1320_Animation::play(void) {
+  while (update())
+    ;
+}
+
+/** \brief Loop.
+    Start over after the last frame. Only PROGMEM animations can loop.
+*/
+void SSD1320_Animation::setLoop(boolean loop) {
+  _loop = loop;
+}
+
+/** \brief Set the frame rate.
+    Override the frame time stored in the animation. 0 draws frames as fast as they can be sent.
+    Can be called before or after begin(), and holds for every animation begun after it.
+*/
+void SSD1320_Animation::setFrameRate(uint8_t framesPerSecond) {
+  _frameTime = (framesPerSecond > 0) ? 1000 / framesPerSecond : 0;
+  _frameRateSet = true;
+}
+
+/** \brief Frames drawn.
+    How many frames have been drawn since begin() or the last loop.
+*/
+uint16_t SSD1320_Animation::getFrame(void) {
+  return _frame;
+}
+
+/** \brief Frame count.
+    Number of frames in the animation.
+*/
+uint16_t SSD1320_Animation::getFrames(void) {
+  return _frames;
+}
+
+/** \brief Animation width.
+    Width in pixels.
+*/
+uint8_t SSD1320_Animation::getWidth(void) {
+  return _width;
+}
+
+/** \brief Animation height.
+    Height in pixels.
+*/
+uint8_t SSD1320_Animation::getHeight(void) {
+  return _height;
+}
+
+boolean SSD1320_Animation::readHeader(void) {
+  _timedOut = false;
+  _format = readByte();
+  _width = readByte();
+  _height = readByte();
+  _frames = readByte();
+  _frames |= (uint16_t)readByte() << 8;
+  uint16_t frameTime = readByte();
+  frameTime |= (uint16_t)readByte() << 8;
+  if (!_frameRateSet) _frameTime = frameTime;
+
+  _frame = 0;
+  _due = millis();
+  _playing = !_timedOut && (_format == IMAGE_1BPP || _format == IMAGE_4BPP) &&
+             (_width > 0) && (_width <= SSD1320_WIDTH) && (_height > 0);
+  return _playing;
+}
+
+// Read one frame and write its rectangles into GDRAM. Returns false if the stream ran dry
+// or a rectangle is wider than a display row.
+boolean SSD1320_Animation::drawFrame(void) {
+  uint8_t pixelsPerByte = (_format == IMAGE_4BPP) ? 2 : 8;
+  uint8_t row[SSD1320_WIDTH / 2];
+  uint8_t rowBuffer[SSD1320_WIDTH / 2];
+
+  uint8_t rectangles = readByte();
+  for (uint8_t i = 0 ; i < rectangles ; i++)
+  {
+    uint8_t x = readByte();
+    uint8_t y = readByte();
+    uint8_t width = readByte();
+    uint8_t height = readByte();
+    if (_timedOut || width > sizeof(row)) return false;
+
+    //Part of the rectangle on the display, in GDRAM columns
+    uint16_t startColumn = _x / 2 + (uint16_t)x * pixelsPerByte / 2;
+    uint16_t bottom = (uint16_t)_y + y;
+    uint8_t columns = 0, rows = 0;
+    if (startColumn < SSD1320_WIDTH / 2 && bottom < SSD1320_HEIGHT)
+    {
+      uint16_t wanted = (uint16_t)width * pixelsPerByte / 2;
+      columns = (wanted < SSD1320_WIDTH / 2 - startColumn) ? wanted : SSD1320_WIDTH / 2 - startColumn;
+      rows = (height < SSD1320_HEIGHT - bottom) ? height : SSD1320_HEIGHT - bottom;
+    }
+
+    if (columns > 0 && rows > 0)
+    {
+      _oled->setWindow(startColumn, startColumn + columns - 1, bottom, bottom + rows - 1);
+    }
+
+    //Each rectangle's PackBits data starts fresh
+    SSD1320_ImageReader pixels = (_source != NULL) ?
+                                 SSD1320_ImageReader(*_source, _format | IMAGE_PACKBITS) :
+                                 SSD1320_ImageReader(_spot, _format | IMAGE_PACKBITS);
+
+    //All rows are read, only the visible ones are sent
+    for (uint8_t r = 0 ; r < height ; r++)
+    {
+      pixels.read(row, width);
+      if (pixels.isTimedOut())
+      {
+        _timedOut = true;
+        return false;
+      }
+      if (r >= rows || columns == 0) continue;
+
+      if (_format == IMAGE_4BPP)
+        _oled->writeData(row, columns);
+      else
+      {
+        SSD1320::expandBits(row, 0, rowBuffer, columns);
+        _oled->writeData(rowBuffer, columns);
+      }
+    }
+    if (_source == NULL) _spot = pixels.getPosition();
+  }
+  return !_timedOut;
+}
+
+uint8_t SSD1320_Animation::readByte(void) {
+  uint8_t value = 0;
+  readBytes(&value, 1);
+  return value;
+}
+
+// Read length bytes from PROGMEM or the stream. Sets _timedOut when the stream runs dry.
+void SSD1320_Animation::readBytes(uint8_t *buffer, uint8_t length) {
+  if (_source == NULL)
+  {
+    memcpy_P(buffer, _spot, length);
+    _spot += length;
+  }
+  else if (_source->readBytes(buffer, length) != length)
+    _timedOut = true;
+}
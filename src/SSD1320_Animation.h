@@ -0,0 +1,73 @@
+/*
+  Delta frame animation player for the SSD1320 driver.
+
+  An animation is made by extras/tools/ssd1320_animation.py and played from PROGMEM or
+  from any Stream (an SD card File, Serial...). Each frame only holds the rectangles that
+  changed since the frame before, so a frame that moves a spinner costs a few dozen bytes
+  of flash and SPI instead of a whole screen.
+
+  Format, multi-byte values LSB first:
+    format, width, height, frames (2 bytes), frame time in ms (2 bytes)
+    then for each frame:
+      count, then count rectangles of
+        x, y, width, height, PackBits data for width * height bytes
+  format is IMAGE_4BPP or IMAGE_1BPP and rows are stored as in SSD1320_Image.h. For a
+  rectangle, x and width count bytes of a row: pairs of pixels for IMAGE_4BPP, eight
+  pixels for IMAGE_1BPP. y and height count rows from the bottom. The PackBits data of
+  each rectangle starts fresh and its runs may cross rows. A frame with no rectangles
+  holds the last one on screen. The first frame covers the whole animation, so playing
+  can start over on any screen.
+
+  Frames are written straight into GDRAM one row at a time, 1-bit ones as full white and
+  black, through a row buffer of SSD1320_WIDTH / 2 bytes. The screen buffer is not used:
+  display() draws over the animation.
+
+  Call update() often, from loop() for example. It draws the next frame once it is due,
+  so the animation keeps its frame rate while the sketch does other work. play() plays
+  it through and returns when it ends.
+*/
+
+#ifndef SSD1320_ANIMATION_H
+#define SSD1320_ANIMATION_H
+
+#include "SSD1320_OLED.h"
+#include "SSD1320_Image.h"
+
+#define ANIMATION_HEADERSIZE 7
+
+class SSD1320_Animation {
+  public:
+    SSD1320_Animation(SSD1320 &oled);
+
+    boolean begin(const uint8_t *animation, uint8_t x = 0, uint8_t y = 0);
+    boolean begin(Stream &source, uint8_t x = 0, uint8_t y = 0);
+    boolean update(void);
+    void play(void);
+
+    void setLoop(boolean loop);
+    void setFrameRate(uint8_t framesPerSecond);
+
+    uint16_t getFrame(void);
+    uint16_t getFrames(void);
+    uint8_t getWidth(void);
+    uint8_t getHeight(void);
+
+  private:
+    SSD1320 *_oled;
+    const uint8_t *_animation, *_spot; // PROGMEM source
+    Stream *_source;                   // or a Stream
+
+    uint8_t _x, _y;
+    uint8_t _format, _width, _height;
+    uint16_t _frames, _frame, _frameTime;
+    unsigned long _due;
+    boolean _loop, _playing, _timedOut;
+    boolean _frameRateSet; // setFrameRate() overrides the header
+
+    boolean readHeader(void);
+    boolean drawFrame(void);
+    uint8_t readByte(void);
+    void readBytes(uint8_t *buffer, uint8_t length);
+};
+
+#endif
@@ -0,0 +1,311 @@
+/*
+  Streaming BMP decoder for the SSD1320 driver. See SSD1320_BMP.h.
+*/
+
+#include "SSD1320_BMP.h"
+
+#define BMP_FILEHEADERSIZE 14
+#define BMP_INFOHEADERSIZE 40 // BITMAPINFOHEADER, the later versions only add to it
+
+//Color table as gray levels, for the image being decoded. Static like the screen buffer, so
+//the largest palette (8-bit) doesn't sit on the stack next to the row and dither buffers.
+static uint8_t palette[256];
+
+/** \brief BMP decoder constructor.
+    Images are drawn onto oled. Call begin() on it first.
+*/
+SSD1320_BMP::SSD1320_BMP(SSD1320 &oled) {
+  _oled = &oled;
+  _width = 0;
+  _height = 0;
+  _bitsPerPixel = 0;
+  _dither = DITHER_NONE;
+  _scaling = SCALE_BOX;
+}
+
+/** \brief Draw a BMP.
+    Read a BMP from source and draw it with its bottom left corner at x,y. Returns BMP_OK,
+    or BMP_NOT_BMP, BMP_UNSUPPORTED or BMP_TIMEOUT. Reads exactly the bytes of the image
+    unless the header is rejected. source's setTimeout() sets how long to wait for each byte.
+*/
+uint8_t SSD1320_BMP::draw(Stream &source, int16_t x, int16_t y) {
+  return decode(source, x, y, false, NULL, 0, 0);
+}
+
+/** \brief Draw a BMP in the middle of the display.
+    As draw(), but the image is centered. Bigger images show their middle part.
+*/
+uint8_t SSD1320_BMP::drawCentered(Stream &source) {
+  return decode(source, 0, 0, true, NULL, 0, 0);
+}
+
+/** \brief Draw a BMP shrunk to fit a box.
+    As draw(), but an image bigger than width x height is shrunk, keeping its shape, until it
+    fits. The image is centered in the box with its bottom left corner at x,y. Scaling is set
+    by setScaling(). The scaler's buffer is static (see SSD1320_Scaler.h), not on the stack.
+*/
+uint8_t SSD1320_BMP::drawScaled(Stream &source, int16_t x, int16_t y, uint8_t width, uint8_t height) {
+  if (width > SSD1320_WIDTH) width = SSD1320_WIDTH;
+  SSD1320_Scaler scaler(_scaling);
+  return decode(source, x, y, false, &scaler, width, height);
+}
+
+/** \brief Draw a BMP shrunk to fit the display.
+    As drawScaled() with the whole display as the box.
+*/
+uint8_t SSD1320_BMP::drawFitted(Stream &source) {
+  return drawScaled(source, 0, 0, SSD1320_WIDTH, SSD1320_HEIGHT);
+}
+
+/** \brief Set dithering.
+    How 8-bit gray is brought down to the panel's 16 levels: DITHER_NONE (the default)
+    rounds, DITHER_BAYER and DITHER_FLOYD dither. Smooth gradients and photos look better dithered.
+*/
+void SSD1320_BMP::setDither(uint8_t method) {
+  _dither = method;
+}
+
+/** \brief Set scaling.
+    How drawScaled() and drawFitted() shrink images: SCALE_BOX (the default) averages,
+    SCALE_NEAREST picks pixels. See SSD1320_Scaler.h.
+*/
+void SSD1320_BMP::setScaling(uint8_t method) {
+  _scaling = method;
+}
+
+/** \brief Image width.
+    Width in pixels of the last image drawn.
+*/
+int16_t SSD1320_BMP::getWidth(void) {
+  return _width;
+}
+
+/** \brief Image height.
+    Height in pixels of the last image drawn.
+*/
+int16_t SSD1320_BMP::getHeight(void) {
+  return _height;
+}
+
+/** \brief Image bits per pixel.
+    1, 4, 8 or 24 for the last image drawn.
+*/
+uint8_t SSD1320_BMP::getBitsPerPixel(void) {
+  return _bitsPerPixel;
+}
+
+// Next byte of the file. Reads ahead at most up to _end so nothing past the image is taken
+// from the stream. Returns 0 and sets _timedOut when the stream runs dry.
+uint8_t SSD1320_BMP::readByte(void) {
+  if (_chunkSpot == _chunkLength)
+  {
+    uint32_t wanted = _end - _position;
+    if (wanted > BMP_CHUNK_SIZE) wanted = BMP_CHUNK_SIZE;
+    if (wanted == 0) wanted = 1;
+
+    _chunkLength = _source->readBytes(_chunk, wanted);
+    _chunkSpot = 0;
+    if (_chunkLength == 0)
+    {
+      _timedOut = true;
+      return 0;
+    }
+  }
+  _position++;
+  return _chunk[_chunkSpot++];
+}
+
+uint16_t SSD1320_BMP::read16(void) {
+  uint16_t value = readByte();
+  return value | ((uint16_t)readByte() << 8);
+}
+
+uint32_t SSD1320_BMP::read32(void) {
+  uint32_t value = read16();
+  return value | ((uint32_t)read16() << 16);
+}
+
+// Read and drop bytes up to position in the file
+void SSD1320_BMP::skipTo(uint32_t position) {
+  while (_position < position && !_timedOut) readByte();
+}
+
+uint8_t SSD1320_BMP::decode(Stream &source, int16_t x, int16_t y, boolean center,
+                            SSD1320_Scaler *scaler, uint8_t boxWidth, uint8_t boxHeight) {
+  _source = &source;
+  _chunkLength = 0;
+  _chunkSpot = 0;
+  _position = 0;
+  _timedOut = false;
+
+  //File header and the size of the info header
+  _end = BMP_FILEHEADERSIZE + 4;
+  if (readByte() != 'B' || readByte() != 'M') return (_timedOut ? BMP_TIMEOUT : BMP_NOT_BMP);
+  read32(); //File size
+  read32(); //Reserved
+  uint32_t offset = read32();
+  uint32_t headerSize = read32();
+  if (_timedOut) return BMP_TIMEOUT;
+  if (headerSize < BMP_INFOHEADERSIZE) return BMP_UNSUPPORTED; //OS/2 BITMAPCOREHEADER
+
+  //Info header
+  _end = BMP_FILEHEADERSIZE + headerSize;
+  int32_t width = (int32_t)read32();
+  int32_t height = (int32_t)read32();
+  uint16_t planes = read16();
+  _bitsPerPixel = read16();
+  uint32_t compression = read32();
+  read32(); //Image size
+  read32(); //Horizontal resolution
+  read32(); //Vertical resolution
+  uint32_t colorsUsed = read32();
+  skipTo(_end);
+  if (_timedOut) return BMP_TIMEOUT;
+
+  _topDown = (height < 0);
+  if (_topDown) height = -height;
+  if (width <= 0 || width > 0x7FFF || height == 0 || height > 0x7FFF || planes != 1 || compression != 0)
+    return BMP_UNSUPPORTED;
+  if (_bitsPerPixel != 1 && _bitsPerPixel != 4 && _bitsPerPixel != 8 && _bitsPerPixel != 24)
+    return BMP_UNSUPPORTED;
+  _width = width;
+  _height = height;
+
+  //Color table as gray levels. Each entry is blue, green, red, unused.
+  uint16_t colors = (_bitsPerPixel <= 8) ? 1 << _bitsPerPixel : 0;
+  if (colors > 0)
+  {
+    memset(palette, 0, colors); //Indexes past colorsUsed are black
+    if (colorsUsed > 0 && colorsUsed < colors) colors = colorsUsed;
+
+    _end = offset;
+    for (uint16_t i = 0 ; i < colors && _position + 4 <= offset ; i++)
+    {
+      uint8_t blue = readByte();
+      uint8_t green = readByte();
+      uint8_t red = readByte();
+      readByte();
+      palette[i] = ((uint16_t)red * 77 + (uint16_t)green * 150 + (uint16_t)blue * 29) >> 8;
+    }
+  }
+  if (offset < _position) return BMP_UNSUPPORTED;
+  skipTo(offset);
+  if (_timedOut) return BMP_TIMEOUT;
+
+  //Size on the display
+  int16_t outWidth = _width, outHeight = _height;
+  if (scaler != NULL)
+  {
+    uint8_t width = boxWidth, height = boxHeight;
+    SSD1320_Scaler::fit(_width, _height, width, height);
+    scaler->begin(_width, _height, width, height);
+    outWidth = scaler->getWidth();
+    outHeight = scaler->getHeight();
+    x += (boxWidth - outWidth) / 2;
+    y += (boxHeight - outHeight) / 2;
+  }
+
+  if (center)
+  {
+    x = ((int16_t)SSD1320_WIDTH - outWidth) / 2;
+    y = ((int16_t)SSD1320_HEIGHT - outHeight) / 2;
+  }
+
+  //Part of the display the image covers. GDRAM columns are pairs of pixels.
+  int16_t left = (x < 0) ? 0 : x;
+  int16_t right = (x + (int32_t)outWidth > SSD1320_WIDTH) ? SSD1320_WIDTH : x + outWidth;
+  int16_t bottom = (y < 0) ? 0 : y;
+  int16_t top = (y + (int32_t)outHeight > SSD1320_HEIGHT) ? SSD1320_HEIGHT : y + outHeight;
+  boolean onScreen = (left < right) && (bottom < top);
+  uint8_t startColumn = left / 2;
+  uint8_t columns = onScreen ? (right - 1) / 2 - startColumn + 1 : 0;
+
+  //Rows are padded to 4 bytes. A 24-bit row can be up to 98 KB.
+  uint32_t rowBytes = ((uint32_t)_width * _bitsPerPixel + 31) / 32 * 4;
+  _end = offset + rowBytes * _height;
+
+  //Bottom-up rows arrive in GDRAM order, so one window takes them all
+  if (onScreen && !_topDown)
+    _oled->setWindow(startColumn, startColumn + columns - 1, bottom, top - 1);
+
+  uint8_t rowBuffer[SSD1320_WIDTH / 2];
+  SSD1320_Dither dither(_dither);
+  dither.begin(16);
+  int16_t outRow = 0;
+
+  for (int16_t row = 0 ; row < _height ; row++)
+  {
+    int16_t screenRow = y + (_topDown ? outHeight - 1 - outRow : outRow);
+    boolean visible = onScreen && (screenRow >= bottom) && (screenRow < top);
+
+    memset(rowBuffer, 0, columns);
+    uint32_t used = 0;
+    uint8_t bits = 0, bitsLeft = 0;
+    if (visible && scaler == NULL) dither.nextRow();
+
+    for (int16_t i = 0 ; i < _width ; i++)
+    {
+      uint8_t gray;
+      if (_bitsPerPixel == 24)
+      {
+        uint8_t blue = readByte();
+        uint8_t green = readByte();
+        uint8_t red = readByte();
+        used += 3;
+        gray = ((uint16_t)red * 77 + (uint16_t)green * 150 + (uint16_t)blue * 29) >> 8;
+      }
+      else
+      {
+        //Pixels are packed from the MSB
+        if (bitsLeft == 0)
+        {
+          bits = readByte();
+          used++;
+          bitsLeft = 8;
+        }
+        gray = palette[bits >> (8 - _bitsPerPixel)];
+        bits <<= _bitsPerPixel;
+        bitsLeft -= _bitsPerPixel;
+      }
+
+      int16_t column = x + i;
+      if (scaler != NULL)
+        scaler->pixel(gray);
+      else if (visible && column >= left && column < right)
+        rowBuffer[column / 2 - startColumn] |= dither.pixel(column, gray) << ((column & 1) ? 4 : 0); //The low nibble is the left pixel
+    }
+
+    while (used < rowBytes)
+    {
+      readByte();
+      used++;
+    }
+    if (_timedOut) return BMP_TIMEOUT;
+
+    if (scaler != NULL)
+    {
+      //A scaled row is only drawn once the scaler has gathered enough source rows
+      if (!scaler->endRow()) continue;
+
+      if (visible)
+      {
+        dither.nextRow();
+        for (int16_t i = 0 ; i < outWidth ; i++)
+        {
+          int16_t column = x + i;
+          if (column >= left && column < right)
+            rowBuffer[column / 2 - startColumn] |= dither.pixel(column, scaler->get(i)) << ((column & 1) ? 4 : 0);
+        }
+      }
+    }
+    outRow++;
+
+    if (visible)
+    {
+      if (_topDown) _oled->setWindow(startColumn, startColumn + columns - 1, screenRow, screenRow);
+      _oled->writeData(rowBuffer, columns);
+    }
+  }
+
+  return BMP_OK;
+}
@@ -0,0 +1,77 @@
+/*
+  Streaming BMP decoder for the SSD1320 driver.
+
+  Reads a Windows BMP from any Stream (Serial, an SD card File, a network client) and
+  writes it straight into the display's GDRAM one row at a time. Only one row of the
+  display (SSD1320_WIDTH / 2 bytes) and the palette are held in RAM, never the image. The
+  row is on the stack while an image is drawn. The palette is a 256 byte static table, big
+  enough for 8-bit images and shared by every SSD1320_BMP, so it costs no stack.
+
+  Supported: uncompressed 1, 4, 8 and 24 bits per pixel, bottom-up or top-down. Colors
+  are turned into gray by luminance and shown with the panel's 16 levels, dithered as
+  set by setDither() (see SSD1320_Dither.h). Dithering takes another SSD1320_WIDTH + 2
+  bytes of stack while an image is drawn.
+
+  The image is placed like rectFill(): x, y is its bottom left corner in screen buffer
+  coordinates and it covers x to x + width - 1, y to y + height - 1. Anything outside the
+  panel is clipped. drawCentered() centers it instead, so an image bigger than the panel
+  shows its middle. drawScaled() and drawFitted() shrink a bigger image to fit, with
+  SSD1320_Scaler as it streams in. The left edge is rounded down to an even column
+  because each GDRAM byte holds two pixels. The screen buffer and setRotation() are not
+  used: display() draws over the image.
+*/
+
+#ifndef SSD1320_BMP_H
+#define SSD1320_BMP_H
+
+#include "SSD1320_OLED.h"
+#include "SSD1320_Dither.h"
+#include "SSD1320_Scaler.h"
+
+// draw() results
+#define BMP_OK          0
+#define BMP_NOT_BMP     1 // Doesn't start with "BM"
+#define BMP_UNSUPPORTED 2 // Compressed, unusual header or bits per pixel
+#define BMP_TIMEOUT     3 // The stream stopped before the end of the image
+
+#define BMP_CHUNK_SIZE  16 // Bytes read from the stream at a time
+
+class SSD1320_BMP {
+  public:
+    SSD1320_BMP(SSD1320 &oled);
+
+    uint8_t draw(Stream &source, int16_t x = 0, int16_t y = 0);
+    uint8_t drawCentered(Stream &source);
+    uint8_t drawScaled(Stream &source, int16_t x, int16_t y, uint8_t width, uint8_t height);
+    uint8_t drawFitted(Stream &source);
+    void setDither(uint8_t method);
+    void setScaling(uint8_t method);
+
+    // Of the last image drawn
+    int16_t getWidth(void);
+    int16_t getHeight(void);
+    uint8_t getBitsPerPixel(void);
+
+  private:
+    SSD1320 *_oled;
+    Stream *_source;
+
+    int16_t _width, _height;
+    uint8_t _bitsPerPixel;
+    boolean _topDown;
+    uint8_t _dither, _scaling;
+
+    uint8_t _chunk[BMP_CHUNK_SIZE];
+    uint8_t _chunkLength, _chunkSpot;
+    uint32_t _position, _end;
+    boolean _timedOut;
+
+    uint8_t decode(Stream &source, int16_t x, int16_t y, boolean center,
+                   SSD1320_Scaler *scaler, uint8_t boxWidth, uint8_t boxHeight);
+    uint8_t readByte(void);
+    uint16_t read16(void);
+    uint32_t read32(void);
+    void skipTo(uint32_t position);
+};
+
+#endif
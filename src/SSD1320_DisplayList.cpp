@@ -0,0 +1,284 @@
+/*
+  Retained-mode display list for the SSD1320 driver. See SSD1320_DisplayList.h.
+*/
+
+#include "SSD1320_DisplayList.h"
+
+#define ARGS_VARIABLE 0xFE // Count byte then that many bytes
+#define ARGS_INVALID  0xFF // Can't be in a display list
+
+// Argument bytes after each commCommand_t opcode
+static const uint8_t commandArgs[] PROGMEM = {
+  1,             // CMD_CLEAR
+  1,             // CMD_INVERT
+  1,             // CMD_CONTRAST
+  0,             // CMD_DISPLAY
+  2,             // CMD_SETCURSOR
+  2,             // CMD_PIXEL
+  4,             // CMD_LINE
+  3,             // CMD_LINEH
+  3,             // CMD_LINEV
+  4,             // CMD_RECT
+  4,             // CMD_RECTFILL
+  3,             // CMD_CIRCLE
+  3,             // CMD_CIRCLEFILL
+  3,             // CMD_DRAWCHAR
+  ARGS_INVALID,  // CMD_DRAWBITMAP
+  ARGS_INVALID,  // CMD_GETLCDWIDTH
+  ARGS_INVALID,  // CMD_GETLCDHEIGHT
+  1,             // CMD_SETCOLOR
+  1,             // CMD_SETDRAWMODE
+  1,             // CMD_SETFONTTYPE
+  ARGS_VARIABLE  // CMD_PRINT
+};
+
+#define TOTALCOMMANDS (sizeof(commandArgs) / sizeof(commandArgs[0]))
+
+/** \brief Display list constructor.
+    Record into buffer, which can hold size bytes. The list starts empty.
+*/
+SSD1320_DisplayList::SSD1320_DisplayList(uint8_t *buffer, uint16_t size) {
+  _buffer = buffer;
+  _size = size;
+  _replayed = false;
+  _lastChecksum = 0;
+  reset();
+}
+
+/** \brief Empty the list.
+    Start recording a new frame. replayIfChanged() still remembers the last frame it drew.
+*/
+void SSD1320_DisplayList::reset(void) {
+  _length = 0;
+  _printSpot = 0;
+  _full = false;
+}
+
+/** \brief Get list length.
+    Bytes recorded so far.
+*/
+uint16_t SSD1320_DisplayList::length(void) {
+  return _length;
+}
+
+/** \brief Set list length.
+    Use a list that was copied into the buffer from elsewhere, for example received over a link.
+*/
+void SSD1320_DisplayList::setLength(uint16_t length) {
+  _length = (length < _size) ? length : _size;
+  _printSpot = 0;
+  _full = false;
+}
+
+/*
+  Return a pointer to the start of the list for storing or sending it.
+*/
+uint8_t *SSD1320_DisplayList::getBuffer(void) {
+  return _buffer;
+}
+
+/** \brief List full.
+    True if a draw call didn't fit since the last reset(). The list then holds only the calls before it.
+*/
+boolean SSD1320_DisplayList::isFull(void) {
+  return _full;
+}
+
+/** \brief List checksum.
+    32-bit FNV-1a hash of the recorded bytes. Frames with different checksums are different;
+    equal checksums don't prove the frames are equal, two lists can collide.
+*/
+uint32_t SSD1320_DisplayList::checksum(void) {
+  uint32_t hash = 2166136261UL;
+  for (uint16_t x = 0 ; x < _length ; x++)
+    hash = (hash ^ _buffer[x]) * 16777619UL;
+  return hash;
+}
+
+/** \brief Replay the list.
+    Run every recorded call on oled. Returns false if the list holds something that isn't
+    a valid command, everything before it has been drawn.
+*/
+boolean SSD1320_DisplayList::replay(SSD1320 &oled) {
+  uint16_t spot = 0;
+  while (spot < _length)
+  {
+    uint16_t used = execute(oled, _buffer + spot, _length - spot);
+    if (used == 0) return false;
+    spot += used;
+  }
+
+  _lastChecksum = checksum();
+  _replayed = true;
+  return true;
+}
+
+/** \brief Replay the list if it changed.
+    Replay only if the list's checksum differs from the one last replayed. A changed list whose
+    checksum collides with the last one is skipped; call replay() when every frame must be drawn.
+    Returns true if it was replayed, so the caller knows whether a display() is needed.
+*/
+boolean SSD1320_DisplayList::replayIfChanged(SSD1320 &oled) {
+  if (_replayed && checksum() == _lastChecksum) return false;
+  return replay(oled);
+}
+
+/** \brief Run one command.
+    Run the command at the start of command on oled. Returns the bytes it took, or 0 if
+    it isn't a valid command or fewer than length bytes hold it.
+*/
+uint16_t SSD1320_DisplayList::execute(SSD1320 &oled, const uint8_t *command, uint16_t length) {
+  uint16_t used = commandLength(command, length);
+  if (used == 0) return 0;
+
+  const uint8_t *a = command + 1;
+  switch (command[0])
+  {
+    case CMD_CLEAR:       oled.clearDisplay(a[0]); break;
+    case CMD_INVERT:      oled.invert(a[0]); break;
+    case CMD_CONTRAST:    oled.setContrast(a[0]); break;
+    case CMD_DISPLAY:     oled.display(); break;
+    case CMD_SETCURSOR:   oled.setCursor(a[0], a[1]); break;
+    case CMD_PIXEL:       oled.setPixel(a[0], a[1]); break;
+    case CMD_LINE:        oled.line(a[0], a[1], a[2], a[3]); break;
+    case CMD_LINEH:       oled.lineH(a[0], a[1], a[2]); break;
+    case CMD_LINEV:       oled.lineV(a[0], a[1], a[2]); break;
+    case CMD_RECT:        oled.rect(a[0], a[1], a[2], a[3]); break;
+    case CMD_RECTFILL:    oled.rectFill(a[0], a[1], a[2], a[3]); break;
+    case CMD_CIRCLE:      oled.circle(a[0], a[1], a[2]); break;
+    case CMD_CIRCLEFILL:  oled.circleFill(a[0], a[1], a[2]); break;
+    case CMD_DRAWCHAR:    oled.drawChar(a[0], a[1], a[2]); break;
+    case CMD_SETCOLOR:    oled.setColor(a[0]); break;
+    case CMD_SETDRAWMODE: oled.setDrawMode(a[0]); break;
+    case CMD_SETFONTTYPE: oled.setFontType(a[0]); break;
+    case CMD_PRINT:
+      for (uint8_t x = 0 ; x < a[0] ; x++) oled.write(a[1 + x]);
+      break;
+  }
+
+  return used;
+}
+
+/** \brief Command length.
+    Bytes taken by the command at the start of command, or 0 if it isn't a valid display
+    list command or fewer than length bytes hold it.
+*/
+uint16_t SSD1320_DisplayList::commandLength(const uint8_t *command, uint16_t length) {
+  if (length == 0 || command[0] >= TOTALCOMMANDS) return 0;
+
+  uint8_t args = pgm_read_byte(commandArgs + command[0]);
+  if (args == ARGS_INVALID) return 0;
+
+  uint16_t used = 1 + ((args == ARGS_VARIABLE) ? 1 : args);
+  if (used > length) return 0;
+  if (args == ARGS_VARIABLE)
+  {
+    used += command[1];
+    if (used > length) return 0;
+  }
+  return used;
+}
+
+// Add one command with up to four argument bytes
+boolean SSD1320_DisplayList::record(uint8_t command, uint8_t argCount, uint8_t a, uint8_t b, uint8_t c, uint8_t d) {
+  if (_full || _length + 1 + argCount > _size)
+  {
+    _full = true;
+    return false;
+  }
+
+  uint8_t *spot = _buffer + _length;
+  spot[0] = command;
+  if (argCount > 0) spot[1] = a;
+  if (argCount > 1) spot[2] = b;
+  if (argCount > 2) spot[3] = c;
+  if (argCount > 3) spot[4] = d;
+
+  _length += 1 + argCount;
+  _printSpot = 0;
+  return true;
+}
+
+/** \brief Record text.
+    Characters written back to back share one CMD_PRINT of up to 255 characters.
+*/
+size_t SSD1320_DisplayList::write(uint8_t c) {
+  if (_printSpot && _buffer[_printSpot] < 255 && !_full && _length < _size)
+  {
+    _buffer[_printSpot]++;
+    _buffer[_length++] = c;
+    return 1;
+  }
+
+  if (!record(CMD_PRINT, 2, 1, c)) return 0;
+  _printSpot = _length - 2;
+  return 1;
+}
+
+boolean SSD1320_DisplayList::clearDisplay(uint8_t mode) {
+  return record(CMD_CLEAR, 1, mode);
+}
+
+boolean SSD1320_DisplayList::invert(boolean inv) {
+  return record(CMD_INVERT, 1, inv);
+}
+
+boolean SSD1320_DisplayList::setContrast(uint8_t contrast) {
+  return record(CMD_CONTRAST, 1, contrast);
+}
+
+boolean SSD1320_DisplayList::display(void) {
+  return record(CMD_DISPLAY, 0);
+}
+
+boolean SSD1320_DisplayList::setCursor(uint8_t x, uint8_t y) {
+  return record(CMD_SETCURSOR, 2, x, y);
+}
+
+boolean SSD1320_DisplayList::setPixel(uint8_t x, uint8_t y) {
+  return record(CMD_PIXEL, 2, x, y);
+}
+
+boolean SSD1320_DisplayList::line(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1) {
+  return record(CMD_LINE, 4, x0, y0, x1, y1);
+}
+
+boolean SSD1320_DisplayList::lineH(uint8_t x, uint8_t y, uint8_t width) {
+  return record(CMD_LINEH, 3, x, y, width);
+}
+
+boolean SSD1320_DisplayList::lineV(uint8_t x, uint8_t y, uint8_t height) {
+  return record(CMD_LINEV, 3, x, y, height);
+}
+
+boolean SSD1320_DisplayList::rect(uint8_t x, uint8_t y, uint8_t width, uint8_t height) {
+  return record(CMD_RECT, 4, x, y, width, height);
+}
+
+boolean SSD1320_DisplayList::rectFill(uint8_t x, uint8_t y, uint8_t width, uint8_t height) {
+  return record(CMD_RECTFILL, 4, x, y, width, height);
+}
+
+boolean SSD1320_DisplayList::circle(uint8_t x, uint8_t y, uint8_t radius) {
+  return record(CMD_CIRCLE, 3, x, y, radius);
+}
+
+boolean SSD1320_DisplayList::circleFill(uint8_t x, uint8_t y, uint8_t radius) {
+  return record(CMD_CIRCLEFILL, 3, x, y, radius);
+}
+
+boolean SSD1320_DisplayList::drawChar(uint8_t x, uint8_t y, uint8_t c) {
+  return record(CMD_DRAWCHAR, 3, x, y, c);
+}
+
+boolean SSD1320_DisplayList::setColor(uint8_t color) {
+  return record(CMD_SETCOLOR, 1, color);
+}
+
+boolean SSD1320_DisplayList::setDrawMode(uint8_t mode) {
+  return record(CMD_SETDRAWMODE, 1, mode);
+}
+
+boolean SSD1320_DisplayList::setFontType(uint8_t type) {
+  return record(CMD_SETFONTTYPE, 1, type);
+}
@@ -0,0 +1,86 @@
+/*
+  Retained-mode display list for the SSD1320 driver.
+
+  Draw calls are recorded into a byte buffer supplied by the sketch, as a commCommand_t
+  opcode followed by its arguments (one byte each). The list can be replayed into the
+  screen buffer as often as needed, stored, or sent over a link. checksum() gives a cheap
+  hash of a frame: a different checksum proves the frame changed, the same checksum only
+  makes it very likely that it didn't. replayIfChanged() uses it to skip drawing a scene
+  that hasn't changed.
+
+  Opcode    Arguments
+  CMD_CLEAR       mode
+  CMD_INVERT      inv
+  CMD_CONTRAST    contrast
+  CMD_DISPLAY     -
+  CMD_SETCURSOR   x, y
+  CMD_PIXEL       x, y
+  CMD_LINE        x0, y0, x1, y1
+  CMD_LINEH       x, y, width
+  CMD_LINEV       x, y, height
+  CMD_RECT        x, y, width, height
+  CMD_RECTFILL    x, y, width, height
+  CMD_CIRCLE      x, y, radius
+  CMD_CIRCLEFILL  x, y, radius
+  CMD_DRAWCHAR    x, y, c
+  CMD_SETCOLOR    color
+  CMD_SETDRAWMODE mode
+  CMD_SETFONTTYPE type
+  CMD_PRINT       count, then count characters printed at the cursor
+  CMD_DRAWBITMAP, CMD_GETLCDWIDTH and CMD_GETLCDHEIGHT can't be recorded.
+*/
+
+#ifndef SSD1320_DISPLAYLIST_H
+#define SSD1320_DISPLAYLIST_H
+
+#include "SSD1320_OLED.h"
+
+class SSD1320_DisplayList : public Print {
+  public:
+    SSD1320_DisplayList(uint8_t *buffer, uint16_t size);
+
+    // List functions
+    void reset(void);
+    uint16_t length(void);
+    void setLength(uint16_t length);
+    uint8_t *getBuffer(void);
+    boolean isFull(void);
+    uint32_t checksum(void);
+
+    boolean replay(SSD1320 &oled);
+    boolean replayIfChanged(SSD1320 &oled);
+    static uint16_t execute(SSD1320 &oled, const uint8_t *command, uint16_t length);
+    static uint16_t commandLength(const uint8_t *command, uint16_t length);
+
+    // Recorded draw functions, same arguments as in SSD1320. False if the list is full.
+    boolean clearDisplay(uint8_t mode = CLEAR_ALL);
+    boolean invert(boolean inv);
+    boolean setContrast(uint8_t contrast);
+    boolean display(void);
+    boolean setCursor(uint8_t x, uint8_t y);
+    boolean setPixel(uint8_t x, uint8_t y);
+    boolean line(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
+    boolean lineH(uint8_t x, uint8_t y, uint8_t width);
+    boolean lineV(uint8_t x, uint8_t y, uint8_t height);
+    boolean rect(uint8_t x, uint8_t y, uint8_t width, uint8_t height);
+    boolean rectFill(uint8_t x, uint8_t y, uint8_t width, uint8_t height);
+    boolean circle(uint8_t x, uint8_t y, uint8_t radius);
+    boolean circleFill(uint8_t x, uint8_t y, uint8_t radius);
+    boolean drawChar(uint8_t x, uint8_t y, uint8_t c);
+    boolean setColor(uint8_t color);
+    boolean setDrawMode(uint8_t mode);
+    boolean setFontType(uint8_t type);
+    virtual size_t write(uint8_t);
+
+  private:
+    uint8_t *_buffer;
+    uint16_t _size, _length;
+    uint16_t _printSpot; // Offset of the count byte of the last CMD_PRINT, 0 when it wasn't the last command
+    boolean _full;
+    uint32_t _lastChecksum;
+    boolean _replayed;
+
+    boolean record(uint8_t command, uint8_t argCount, uint8_t a = 0, uint8_t b = 0, uint8_t c = 0, uint8_t d = 0);
+};
+
+#endif
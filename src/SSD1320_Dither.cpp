@@ -0,0 +1,81 @@
+/*
+  Dithering for the SSD1320 driver. See SSD1320_Dither.h.
+*/
+
+#include "SSD1320_Dither.h"
+
+// 4x4 Bayer threshold matrix, 0 to 15
+static const uint8_t bayer4x4[16] PROGMEM = {
+  0,  8,  2, 10,
+  12, 4, 14,  6,
+  3, 11,  1,  9,
+  15, 7, 13,  5
+};
+
+/** \brief Dither constructor.
+    method is DITHER_NONE, DITHER_BAYER or DITHER_FLOYD.
+*/
+SSD1320_Dither::SSD1320_Dither(uint8_t method) {
+  _method = method;
+  begin(16);
+}
+
+/** \brief Start an image.
+    Dither to levels gray levels, 2 to 16: 16 for GDRAM, 2 for the screen buffer.
+*/
+void SSD1320_Dither::begin(uint8_t levels) {
+  if (levels < 2) levels = 2;
+  if (levels > 16) levels = 16;
+  _levels = levels;
+  _row = 0xFF; //The first nextRow() makes it 0
+  memset(_errors, 0, sizeof(_errors));
+  _right = 0;
+  _belowRight = 0;
+}
+
+/** \brief Start a row.
+    Call before the first pixel of every row, including the first.
+*/
+void SSD1320_Dither::nextRow(void) {
+  _row++;
+  _right = 0;
+  _belowRight = 0;
+  _errors[0] = 0; //Left of column 0, nothing reads it
+}
+
+/** \brief Dither a pixel.
+    Returns the level, 0 to levels - 1, for gray (0 to 255) at column x.
+*/
+uint8_t SSD1320_Dither::pixel(uint8_t x, uint8_t gray) {
+  int16_t value = gray;
+  uint8_t steps = _levels - 1;
+
+  if (_method == DITHER_BAYER)
+  {
+    //Spread the threshold over one output step, centered on 0
+    int8_t threshold = pgm_read_byte(bayer4x4 + ((_row & 3) << 2) + (x & 3)) * 2 - 15;
+    value += threshold * (255 / steps) / 32;
+  }
+  else if (_method == DITHER_FLOYD && x < SSD1320_WIDTH)
+  {
+    value += _right + _errors[x + 1];
+  }
+
+  if (value < 0) value = 0;
+  if (value > 255) value = 255;
+
+  uint8_t level = ((uint16_t)value * steps + 127) / 255;
+
+  if (_method == DITHER_FLOYD && x < SSD1320_WIDTH)
+  {
+    int16_t error = value - (int16_t)((uint16_t)level * 255 / steps);
+
+    //7/16 right, 3/16 below left, 5/16 below, 1/16 below right
+    _right = error * 7 / 16;
+    _errors[x] += error * 3 / 16;
+    _errors[x + 1] = _belowRight + error * 5 / 16;
+    _belowRight = error / 16;
+  }
+
+  return level;
+}
@@ -0,0 +1,39 @@
+/*
+  Dithering for the SSD1320 driver.
+
+  Turns 8-bit gray into fewer levels one pixel at a time, as an image streams past:
+  16 levels for GDRAM or 2 for the 1bpp screen buffer. Used by SSD1320_BMP and
+  SSD1320::drawGrayImage(), and usable on its own.
+
+  DITHER_NONE   Round to the nearest level
+  DITHER_BAYER  4x4 ordered dither. No state, pixels can come in any order.
+  DITHER_FLOYD  Floyd-Steinberg error diffusion. Keeps one row of errors
+                (SSD1320_WIDTH + 2 bytes). Give it the pixels of each row left to right.
+
+  Call begin() before each image and nextRow() before each row, then pixel() for each
+  pixel. x is the column on the display, 0 to SSD1320_WIDTH - 1.
+*/
+
+#ifndef SSD1320_DITHER_H
+#define SSD1320_DITHER_H
+
+#include "SSD1320_OLED.h"
+
+class SSD1320_Dither {
+  public:
+    SSD1320_Dither(uint8_t method = DITHER_FLOYD);
+
+    void begin(uint8_t levels);
+    void nextRow(void);
+    uint8_t pixel(uint8_t x, uint8_t gray);
+
+  private:
+    uint8_t _method, _levels, _row;
+
+    //Floyd-Steinberg: _errors[x + 1] is carried from the row above into column x of this
+    //row until column x is drawn, then holds what column x of the next row gets
+    int8_t _errors[SSD1320_WIDTH + 2];
+    int16_t _right, _belowRight;
+};
+
+#endif
@@ -0,0 +1,161 @@
+/*
+  Compressed images for the SSD1320 driver. See SSD1320_Image.h for the format.
+*/
+
+#include "SSD1320_Image.h"
+
+/** \brief Image reader constructor.
+    image is a PROGMEM image made by extras/tools/ssd1320_image.py.
+*/
+SSD1320_ImageReader::SSD1320_ImageReader(const uint8_t *image) {
+  _image = image;
+  _data = image + IMAGE_HEADERSIZE;
+  _source = NULL;
+  _format = pgm_read_byte(image);
+  rewind();
+}
+
+/** \brief Pixel data reader constructor.
+    data is bare PROGMEM pixel data in format (see above), with no header. The size is
+    up to the caller: getWidth() and getHeight() return 0 and isValid() false.
+*/
+SSD1320_ImageReader::SSD1320_ImageReader(const uint8_t *data, uint8_t format) {
+  _image = NULL;
+  _data = data;
+  _source = NULL;
+  _format = format;
+  rewind();
+}
+
+/** \brief Stream pixel data reader constructor.
+    As above, with the pixel data read from source as it is decoded, never past the last
+    byte asked for. source's setTimeout() sets how long to wait for each byte. A Stream
+    can't be rewound.
+*/
+SSD1320_ImageReader::SSD1320_ImageReader(Stream &source, uint8_t format) {
+  _image = NULL;
+  _data = NULL;
+  _source = &source;
+  _format = format;
+  rewind();
+}
+
+/** \brief Check the header.
+    True if the image has a known format and fits the display's width.
+*/
+boolean SSD1320_ImageReader::isValid(void) {
+  uint8_t bits = _format & ~IMAGE_PACKBITS;
+  if (bits != IMAGE_1BPP && bits != IMAGE_4BPP) return false;
+  return (getWidth() > 0) && (getWidth() <= SSD1320_WIDTH) && (getHeight() > 0);
+}
+
+/** \brief Image width.
+    Width in pixels, 0 for bare pixel data.
+*/
+uint8_t SSD1320_ImageReader::getWidth(void) {
+  return (_image != NULL) ? pgm_read_byte(_image + 1) : 0;
+}
+
+/** \brief Image height.
+    Height in pixels, 0 for bare pixel data.
+*/
+uint8_t SSD1320_ImageReader::getHeight(void) {
+  return (_image != NULL) ? pgm_read_byte(_image + 2) : 0;
+}
+
+/** \brief Bits per pixel.
+    4 or 1.
+*/
+uint8_t SSD1320_ImageReader::getBitsPerPixel(void) {
+  return _format & ~IMAGE_PACKBITS;
+}
+
+/** \brief Bytes per row.
+    How many bytes read() gives for each row of the image.
+*/
+uint8_t SSD1320_ImageReader::getStride(void) {
+  return ((uint16_t)getWidth() * getBitsPerPixel() + 7) / 8;
+}
+
+/** \brief Rewind.
+    Go back to the first row.
+*/
+void SSD1320_ImageReader::rewind(void) {
+  _spot = _data;
+  _count = 0;
+  _repeat = false;
+  _timedOut = false;
+}
+
+/** \brief Read pixel data.
+    Decode the next length bytes of pixel data into buffer. Read getStride() bytes for each row.
+*/
+void SSD1320_ImageReader::read(uint8_t *buffer, uint16_t length) {
+  if ((_format & IMAGE_PACKBITS) == 0)
+  {
+    readBytes(buffer, length);
+    return;
+  }
+
+  while (length > 0 && !_timedOut)
+  {
+    if (_count == 0)
+    {
+      uint8_t n = readByte();
+      if (n == 128 || _timedOut) continue;
+
+      _repeat = (n > 128);
+      if (_repeat)
+      {
+        _count = 257 - n;
+        _value = readByte();
+      }
+      else
+        _count = n + 1;
+    }
+
+    uint8_t amount = (length < _count) ? length : _count;
+    if (_repeat)
+      memset(buffer, _value, amount);
+    else
+      readBytes(buffer, amount);
+    buffer += amount;
+    length -= amount;
+    _count -= amount;
+  }
+}
+
+/** \brief Stream ran dry.
+    True once a Stream reader didn't get a byte within the stream's timeout. What read()
+    gave from then on is not valid.
+*/
+boolean SSD1320_ImageReader::isTimedOut(void) {
+  return _timedOut;
+}
+
+/** \brief Read position.
+    The PROGMEM byte after the last one decoded, where whatever follows the pixel data
+    starts. NULL for a Stream reader.
+*/
+const uint8_t *SSD1320_ImageReader::getPosition(void) {
+  return _spot;
+}
+
+uint8_t SSD1320_ImageReader::readByte(void) {
+  if (_source == NULL) return pgm_read_byte(_spot++);
+
+  uint8_t value = 0;
+  readBytes(&value, 1);
+  return value;
+}
+
+// Read length bytes from PROGMEM or the stream. Sets _timedOut when the stream runs dry.
+void SSD1320_ImageReader::readBytes(uint8_t *buffer, uint16_t length) {
+  if (_source == NULL)
+  {
+    memcpy_P(buffer, _spot, length);
+    _spot += length;
+  }
+  else if (_source->readBytes(buffer, length) != length)
+    _timedOut = true;
+}
@@ -0,0 +1,67 @@
+/*
+  Compressed images for the SSD1320 driver.
+
+  An image is a PROGMEM byte array made by extras/tools/ssd1320_image.py:
+    format, width, height, then the pixel data
+  format is IMAGE_4BPP or IMAGE_1BPP, plus IMAGE_PACKBITS when the data is compressed.
+  Rows run from the bottom of the picture up, like the screen buffer, BMP files and the
+  arrays in Example2_Graphics. Each row is padded to whole bytes.
+    IMAGE_4BPP  Two pixels per byte, the left one in the low nibble, as GDRAM stores them
+    IMAGE_1BPP  Eight pixels per byte, the left one in the MSB, as the screen buffer stores them
+  Width can be up to SSD1320_WIDTH, height up to 255.
+
+  Compressed data is PackBits over the whole pixel data, runs may cross rows. Each block
+  starts with a count byte n:
+    0 to 127    n + 1 bytes follow as they are
+    129 to 255  the next byte repeats 257 - n times
+    128         nothing, skip
+  Flat UI art and text shrink several times over. Runs cost a memset() to decode, so
+  decoding is cheaper than reading the raw bytes from flash.
+
+  SSD1320::displayImage() writes an image straight into GDRAM, SSD1320::drawImage() into
+  the screen buffer. SSD1320_ImageReader decodes one for other uses. It also decodes bare
+  pixel data with no header, from PROGMEM or a Stream, which is how SSD1320_Animation reads
+  the rectangles of its frames.
+*/
+
+#ifndef SSD1320_IMAGE_H
+#define SSD1320_IMAGE_H
+
+#include "SSD1320_OLED.h"
+
+#define IMAGE_1BPP       0x01
+#define IMAGE_4BPP       0x04
+#define IMAGE_PACKBITS   0x80
+#define IMAGE_HEADERSIZE 3
+
+class SSD1320_ImageReader {
+  public:
+    SSD1320_ImageReader(const uint8_t *image);
+    SSD1320_ImageReader(const uint8_t *data, uint8_t format);
+    SSD1320_ImageReader(Stream &source, uint8_t format);
+
+    boolean isValid(void);
+    uint8_t getWidth(void);
+    uint8_t getHeight(void);
+    uint8_t getBitsPerPixel(void);
+    uint8_t getStride(void);
+
+    void rewind(void);
+    void read(uint8_t *buffer, uint16_t length);
+    boolean isTimedOut(void);
+    const uint8_t *getPosition(void);
+
+  private:
+    const uint8_t *_image, *_data, *_spot; // PROGMEM header (NULL for bare data), pixel data
+    Stream *_source;                       // or a Stream
+    uint8_t _format;
+    uint8_t _count;   // Bytes left in the current PackBits block
+    boolean _repeat;  // The block is a run of _value
+    uint8_t _value;
+    boolean _timedOut;
+
+    uint8_t readByte(void);
+    void readBytes(uint8_t *buffer, uint16_t length);
+};
+
+#endif
@@ -0,0 +1,154 @@
+/*
+  Cached text labels for the SSD1320 driver. See SSD1320_Labels.h.
+*/
+
+#include "SSD1320_Labels.h"
+
+/** \brief Label cache constructor.
+    Labels are drawn onto oled. pool is size bytes of RAM for the rendered labels.
+*/
+SSD1320_Labels::SSD1320_Labels(SSD1320 &oled, uint8_t *pool, uint16_t size) {
+  _oled = &oled;
+  _pool = pool;
+  _size = size;
+  clear();
+}
+
+/** \brief Draw a label.
+    Draw text in the current font at x,y, like setCursor(x, y) and print(text) with color and
+    mode. The first call renders the label into the pool, later ones only copy it into the
+    screen buffer. Returns false if it didn't fit in the cache and was drawn character by
+    character.
+*/
+boolean SSD1320_Labels::draw(uint8_t x, uint8_t y, const char *text, uint8_t color, uint8_t mode) {
+  label_t *label = find(text);
+
+  //The font or the text has changed since it was rendered
+  if (label != NULL)
+  {
+    const char *copy = (const char *)_pool + label->offset + (uint16_t)(label->width + 7) / 8 * label->height;
+    if (label->font != _oled->getFontType() || strcmp(copy, text) != 0)
+    {
+      drop(label);
+      label = NULL;
+    }
+  }
+
+  if (label == NULL) label = render(text);
+
+  if (label == NULL)
+  {
+    uint8_t cellWidth = _oled->getFontWidth() + 1;
+    for (uint16_t column = x ; *text != 0 && column <= 255 ; column += cellWidth)
+      _oled->drawChar(column, y, *text++, color, mode);
+    return false;
+  }
+
+  _oled->drawBits(x, y, _pool + label->offset, label->width, label->height, color, mode);
+  return true;
+}
+
+/** \brief Forget a label.
+    Free the pool space of text's label. Later labels move down to keep the pool in one piece.
+*/
+void SSD1320_Labels::remove(const char *text) {
+  label_t *label = find(text);
+  if (label != NULL) drop(label);
+}
+
+/** \brief Forget all labels.
+    Empty the cache, for example after changing many labels at once.
+*/
+void SSD1320_Labels::clear(void) {
+  for (uint8_t i = 0 ; i < SSD1320_LABEL_COUNT ; i++)
+    _labels[i].text = NULL;
+  _used = 0;
+}
+
+/** \brief Label width.
+    Width in pixels text takes in the current font, up to 255.
+*/
+uint8_t SSD1320_Labels::getWidth(const char *text) {
+  uint16_t width = strlen(text) * (_oled->getFontWidth() + 1);
+  return (width > 255) ? 255 : width;
+}
+
+/** \brief Label height.
+    Height in pixels of labels in the current font, a multiple of 8.
+*/
+uint8_t SSD1320_Labels::getHeight(void) {
+  uint8_t rows = _oled->getFontHeight() / 8;
+  return ((rows < 1) ? 1 : rows) * 8;
+}
+
+/** \brief Pool used.
+    Bytes of the pool taken by the cached labels.
+*/
+uint16_t SSD1320_Labels::getUsed(void) {
+  return _used;
+}
+
+SSD1320_Labels::label_t *SSD1320_Labels::find(const char *text) {
+  for (uint8_t i = 0 ; i < SSD1320_LABEL_COUNT ; i++)
+    if (_labels[i].text == text) return &_labels[i];
+  return NULL;
+}
+
+// Render text in the current font at the end of the pool. NULL if there's no room.
+SSD1320_Labels::label_t *SSD1320_Labels::render(const char *text) {
+  uint16_t length = strlen(text);
+  uint16_t width = length * (_oled->getFontWidth() + 1);
+  if (length == 0 || width > 255) return NULL;
+
+  label_t *label = find(NULL);
+  if (label == NULL) return NULL;
+
+  uint8_t height = getHeight();
+  uint8_t stride = (width + 7) / 8;
+  uint16_t bytes = (uint16_t)stride * height;
+  if (_used + bytes + length + 1 > _size) return NULL;
+
+  label->text = text;
+  label->font = _oled->getFontType();
+  label->width = width;
+  label->height = height;
+  label->offset = _used;
+  label->length = bytes + length + 1;
+  _used += label->length;
+
+  uint8_t *bitmap = _pool + label->offset;
+  memset(bitmap, 0, bytes);
+  memcpy(bitmap + bytes, text, length + 1);
+
+  //Font columns into rows. Row r of a tall font goes (rows - 1 - r) * 8 up, as drawChar() puts it.
+  uint8_t rows = height / 8;
+  uint8_t cellWidth = _oled->getFontWidth() + 1;
+  for (uint16_t i = 0 ; i < length ; i++)
+  {
+    for (uint8_t row = 0 ; row < rows ; row++)
+    {
+      uint8_t *rowStart = bitmap + (uint16_t)(rows - 1 - row) * 8 * stride;
+      for (uint8_t column = 0 ; column < cellWidth - 1 ; column++)
+      {
+        uint8_t bits = _oled->getCharColumn(text[i], column, row);
+        uint16_t x = i * cellWidth + column;
+        for (uint8_t bit = 0 ; bit < 8 ; bit++)
+          if (bits & (0x80 >> bit))
+            rowStart[bit * stride + x / 8] |= 0x80 >> (x % 8);
+      }
+    }
+  }
+  return label;
+}
+
+// Free a label's pool space and close the gap
+void SSD1320_Labels::drop(label_t *label) {
+  uint16_t end = label->offset + label->length;
+  memmove(_pool + label->offset, _pool + end, _used - end);
+  _used -= label->length;
+
+  for (uint8_t i = 0 ; i < SSD1320_LABEL_COUNT ; i++)
+    if (_labels[i].text != NULL && _labels[i].offset > label->offset)
+      _labels[i].offset -= label->length;
+  label->text = NULL;
+}
@@ -0,0 +1,63 @@
+/*
+  Cached text labels for the SSD1320 driver.
+
+  Static text such as "TEMP", "RPM" or units is decoded from the font glyph by glyph every
+  time it is printed. SSD1320_Labels renders each string once into a 1-bit bitmap in a pool
+  supplied by the sketch and afterwards draws it with SSD1320::drawBits(): a masked store
+  per byte of the label instead of a font lookup and transpose per character.
+
+  draw() looks a label up by the address of its text, so pass a string literal or a buffer
+  that stays put. A copy of the text and the font it was rendered in are kept with the
+  bitmap. If either has changed the label is rendered again, so a buffer rewritten with
+  sprintf() still shows the right text, only without the saving. When the pool or the
+  SSD1320_LABEL_COUNT entries are used up, draw() draws through drawChar() instead.
+
+  A label looks like print() at setCursor(x, y): each character takes getFontWidth() + 1
+  columns and the label is a multiple of 8 pixels tall. It covers its whole box, so with
+  the fonts taller than 8 pixels the column between characters, which print() leaves
+  alone, is drawn as background. A label takes (width + 7) / 8 * height bytes for the
+  bitmap and the text's length + 1 for the copy; "TEMP" in the 5x7 font takes 29.
+*/
+
+#ifndef SSD1320_LABELS_H
+#define SSD1320_LABELS_H
+
+#include "SSD1320_OLED.h"
+
+// Labels that can be cached at once. Each costs 9 bytes of RAM besides the pool.
+#ifndef SSD1320_LABEL_COUNT
+#define SSD1320_LABEL_COUNT 8
+#endif
+
+class SSD1320_Labels {
+  public:
+    SSD1320_Labels(SSD1320 &oled, uint8_t *pool, uint16_t size);
+
+    boolean draw(uint8_t x, uint8_t y, const char *text, uint8_t color = WHITE, uint8_t mode = NORM);
+    void remove(const char *text);
+    void clear(void);
+
+    uint8_t getWidth(const char *text);
+    uint8_t getHeight(void);
+    uint16_t getUsed(void);
+
+  private:
+    typedef struct {
+      const char *text;  // NULL when the entry is free
+      uint8_t font;
+      uint8_t width, height;
+      uint16_t offset;   // Bitmap in the pool, the copy of the text follows it
+      uint16_t length;   // Bytes taken in the pool
+    } label_t;
+
+    SSD1320 *_oled;
+    uint8_t *_pool;
+    uint16_t _size, _used;
+    label_t _labels[SSD1320_LABEL_COUNT];
+
+    label_t *find(const char *text);
+    label_t *render(const char *text);
+    void drop(label_t *label);
+};
+
+#endif
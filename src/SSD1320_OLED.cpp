@@ -8,6 +8,9 @@
 */
 
 #include "SSD1320_OLED.h"
+#include "SSD1320_Dither.h"
+#include "SSD1320_Image.h"
+#include "SSD1320_Scaler.h"
 
 // Add header of the fonts here.  Remove as many as possible to conserve FLASH memory.
 #include "util/font5x7.h"
@@ -30,11 +33,96 @@ const unsigned char *SSD1320::fontsPointer[] = {
 #define SPI3_COMMAND LOW   // Command bit is LOW
 #define SPI3_DATA    HIGH  // Data bit is HIGH
 
+// I2C control bytes. Co = 0 so every byte after it in the transmission is the same kind.
+#define I2C_CONTROL_COMMAND 0x00 // D/C# = 0
+#define I2C_CONTROL_DATA    0x40 // D/C# = 1
+
+// Bytes that fit in one Wire transmission after the control byte
+#if defined(BUFFER_LENGTH)
+#define I2C_CHUNK_SIZE (BUFFER_LENGTH - 1)
+#elif defined(I2C_BUFFER_LENGTH)
+#define I2C_CHUNK_SIZE (I2C_BUFFER_LENGTH - 1)
+#else
+#define I2C_CHUNK_SIZE 31
+#endif
+
+// On AVR the CS, SCLK, SDIN and D/C# pins are written through port registers cached by
+// begin(). digitalWrite() looks every pin up in three PROGMEM tables and checks for PWM.
+// Interrupts are held off for the read-modify-write, as digitalWrite() does.
+#if defined(__AVR__)
+#define PIN_WRITE(pin, value) do { uint8_t oldSREG = SREG; cli(); \
+    if (value) *pin##Port |= pin##Mask; else *pin##Port &= ~pin##Mask; \
+    SREG = oldSREG; } while (0)
+#else
+#define PIN_WRITE(pin, value) digitalWrite(pin, value)
+#endif
+
 enum {
   OLED_INTERFACE_SPI3, // 3-wire SPI interface
+  OLED_INTERFACE_SPI4, // 4-wire SPI interface, D/C# on its own pin
   OLED_INTERFACE_I2C   // I2C interface
 };
 
+#define DEFAULT_CONTRAST 0x5A // Contrast the built in init sequence sets
+
+/** \brief Power up command sequence.
+  Every byte is sent as a command (D/C# low) in a single burst. This is the sequence for the
+  160x32 flexible panel. Other SSD1320 panels may need a different multiplex ratio, display offset
+  or clock divider; build your own table in PROGMEM and hand it to setInitSequence() before begin().
+*/
+static const uint8_t defaultInitSequence[] PROGMEM = {
+  DISPLAYOFF,               // 0xAE - Display off
+  SETDISPLAYCLOCKDIV, 0xC2, // 0xD5 - Clock divide ratio/osc. freq: osc clock=0xC divide ratio = 0x2
+  SETMULTIPLEX, 0x1F,       // 0xA8 - Multiplex ratio: 31
+  SETDISPLAYOFFSET, 0x60,   // 0xD3 - Display offset: 96
+  SETSTARTLINE, 0x00,       // 0xA2 - Start line: Line 0
+  SETSEGREMAP,              // 0xA0 - Segment re-map
+  COMSCANINC,               // 0xC0 - COM Output scan direction
+  SETCOMPINS, 0x12,         // 0xDA - seg pins hardware config
+  SETCONTRAST, DEFAULT_CONTRAST, // 0x81 - Contrast control: value between 0x00 and 0xFF
+  SETPHASELENGTH, 0x22,     // 0xD9 - Pre-charge period
+  SETVCOMDESELECT, 0x30,    // 0xDB - VCOMH Deselect level
+  SELECTIREF, 0x10,         // 0xAD - Internal IREF Enable
+  MEMORYMODE, 0x00,         // 0x20 - Memory addressing mode: Horizontal
+  SETCHARGEPMP1, 0x01,      // 0x8D - Disable internal charge pump
+  SETCHARGEPMP2, 0x00,      // 0xAC - Disable internal charge pump
+  RESETALLON,               // 0xA4 - Entire display off (show GDRAM)
+  RESETINVERT,              // 0xA6 - Normal display (not inverted)
+  DISPLAYON                 // 0xAF - Display on
+};
+
+/** \brief Gray scale table presets.
+  GS1 to GS15 pulse widths for a few gamma curves, level = GRAYTABLE_MAX * (n / 15) ^ gamma.
+  Gamma is given in half steps (2 = 1.0, 5 = 2.5) so the curves can be worked out by the
+  compiler with nothing more than multiplies and a square root. Each row starts with the
+  SETGSTABLE command so a preset goes out as a single 16 byte burst.
+*/
+static constexpr double grayRoot(double x, double guess, uint8_t steps) {
+  return (steps == 0) ? guess : grayRoot(x, (guess + x / guess) / 2, steps - 1);
+}
+
+static constexpr double grayPower(double x, uint8_t n) {
+  return (n == 0) ? 1 : x * grayPower(x, n - 1);
+}
+
+static constexpr uint8_t grayLevel(uint8_t n, uint8_t halfGamma) {
+  return (uint8_t)(GRAYTABLE_MAX * grayPower(n / 15.0, halfGamma / 2)
+                   * ((halfGamma & 1) ? grayRoot(n / 15.0, 1, 8) : 1) + 0.5);
+}
+
+#define GRAYTABLE_ROW(g) { SETGSTABLE, \
+  grayLevel(1, g), grayLevel(2, g), grayLevel(3, g), grayLevel(4, g), grayLevel(5, g), \
+  grayLevel(6, g), grayLevel(7, g), grayLevel(8, g), grayLevel(9, g), grayLevel(10, g), \
+  grayLevel(11, g), grayLevel(12, g), grayLevel(13, g), grayLevel(14, g), grayLevel(15, g) }
+
+static const uint8_t grayTablePresets[][16] PROGMEM = {
+  GRAYTABLE_ROW(2), // GRAYTABLE_LINEAR
+  GRAYTABLE_ROW(3), // GRAYTABLE_GAMMA15
+  GRAYTABLE_ROW(4), // GRAYTABLE_GAMMA20
+  GRAYTABLE_ROW(5)  // GRAYTABLE_GAMMA25
+};
+
+#define TOTALGRAYTABLES (sizeof(grayTablePresets) / sizeof(grayTablePresets[0]))
 
 /** \brief Grayscale Flexible OLED screen buffer.
   Page buffer 80 x 32 = 2,560 bytes are needed for full 4-bit grayscale. We don't have that.
@@ -48,8 +136,9 @@ enum {
   All drawing function will first be drawn on this page buffer, only upon calling
   display() function will transfer the page buffer to the actual LCD controller's memory.
 */
-static uint8_t screenMemory [] = {
+static uint8_t screenMemory [SSD1320_BUFFERSIZE] = {
   //LCD Memory organized in 20 bytes (160 columns) and 32 rows = 640 bytes
+#if (SSD1320_WIDTH == 160) && (SSD1320_HEIGHT == 32)
 
   //SparkFun Electronics Logo in 8-bit glory!
 
@@ -94,6 +183,9 @@ static uint8_t screenMemory [] = {
   0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00,
   0x00 , 0x00 , 0x0F , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00,
   0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00
+#else
+  0 //Other panel sizes start blank
+#endif
 };
 
 SSD1320::SSD1320(uint8_t csPin, uint8_t rstPin, uint8_t sclkPin, uint8_t sdoutPin, SPIClass *spiInterface) {
@@ -103,12 +195,52 @@ SSD1320::SSD1320(uint8_t csPin, uint8_t rstPin, uint8_t sclkPin, uint8_t sdoutPi
   _sd = sdoutPin;
 
   _interface = OLED_INTERFACE_SPI3;
+  _dc = 0;
   _spi = spiInterface;
+  setSPIClock(SSD1320_SPI_CLOCK);
+  _scrolling = false;
+  _rotation = 0;
+  _band = NULL;
+
+  _initSequence = defaultInitSequence;
+  _initLength = sizeof(defaultInitSequence);
+
+  _segRemap = 0;
+  _comScan = 0;
+  _invertCmd = 0;
+  _contrast = 0;
+  _contrastSet = false;
+  _grayPreset = GRAYTABLE_DEFAULT;
+  _grayBrightness = 255;
+
+  _transType = TRANSITION_NONE;
+
+#ifdef SSD1320_ENABLE_I2C
+  _i2c = NULL;
+  _i2cAddress = SSD1320_I2C_ADDRESS;
+  _i2cClock = 400000;
+  _i2cPending = 0;
+#endif
+
+  SSD1320_STAT(_frameCallback = NULL);
 }
 
-void SSD1320::begin(uint16_t lcdWidth, uint16_t lcdHeight) {
-  _displayWidth = lcdWidth;
-  _displayHeight = lcdHeight;
+#ifdef SSD1320_ENABLE_I2C
+/** \brief I2C constructor.
+    Talk to the display over wirePort at address (0x3C with SA0 low, 0x3D with SA0 high).
+    rstPin drives the display's reset line.
+*/
+SSD1320::SSD1320(TwoWire &wirePort, uint8_t address, uint8_t rstPin) : SSD1320(CS_PIN_DEFAULT, rstPin) {
+  _interface = OLED_INTERFACE_I2C;
+  _i2c = &wirePort;
+  _i2cAddress = address;
+}
+#endif
+
+void SSD1320::begin(uint16_t lcdWidth, uint16_t lcdHeight, uint32_t spiClock) {
+  if (spiClock) setSPIClock(spiClock);
+  setDisplayWidth(lcdWidth);
+  setDisplayHeight(lcdHeight);
 
   if (_interface == OLED_INTERFACE_SPI3) {
     pinMode(_cs, OUTPUT);
@@ -120,15 +252,42 @@ void SSD1320::begin(uint16_t lcdWidth, uint16_t lcdHeight) {
     pinMode(_sd, OUTPUT);
     digitalWrite(_sd, LOW);  // SDIN = OUTPUT, init LOW
 
+  } else if (_interface == OLED_INTERFACE_SPI4) {
+    pinMode(_cs, OUTPUT);
+    digitalWrite(_cs, HIGH); // CS = OUTPUT, init HIGH
+    pinMode(_rst, OUTPUT);
+    digitalWrite(_rst, LOW); // RST = OUTPUT, init LOW
+    pinMode(_dc, OUTPUT);
+    digitalWrite(_dc, LOW);  // D/C# = OUTPUT, init LOW
+    _spi->begin(); //Nothing is bit banged in 4-wire mode so the SPI hardware keeps SCLK and SDIN
+
+#ifdef SSD1320_ENABLE_I2C
   } else if (_interface == OLED_INTERFACE_I2C) {
-    //! TODO
+    pinMode(_rst, OUTPUT);
+    digitalWrite(_rst, LOW); // RST = OUTPUT, init LOW
+    _i2c->begin();
+    _i2c->setClock(_i2cClock);
+#endif
   }
 
+#if defined(__AVR__)
+  _csPort = portOutputRegister(digitalPinToPort(_cs));
+  _csMask = digitalPinToBitMask(_cs);
+  _sclkPort = portOutputRegister(digitalPinToPort(_sclk));
+  _sclkMask = digitalPinToBitMask(_sclk);
+  _sdPort = portOutputRegister(digitalPinToPort(_sd));
+  _sdMask = digitalPinToBitMask(_sd);
+  _dcPort = portOutputRegister(digitalPinToPort(_dc));
+  _dcMask = digitalPinToBitMask(_dc);
+#endif
+
   setFontType(0);
   setColor(WHITE);
   setDrawMode(NORM);
   setCursor(0, 0);
 
+  SSD1320_STAT(resetStats());
+
   powerUp();
 }
 
@@ -144,26 +303,28 @@ void SSD1320::begin(uint16_t lcdWidth, uint16_t lcdHeight) {
 */
 void SSD1320::command(uint8_t cmd) {
 
-  if (_interface == OLED_INTERFACE_SPI3) {
-    digitalWrite(_cs, LOW);  // CS LOW
+  if (_interface != OLED_INTERFACE_SPI3) {
+    sendBlock(&cmd, 1, SPI3_COMMAND, false); //No 9th bit to bang
+    return;
+  }
 
-    // Send D/C# bit
-    digitalWrite(_sd, SPI3_COMMAND); // Send command bit
-    digitalWrite(_sclk, HIGH); // SCLK HIGH - clock in on rising edge
-    digitalWrite(_sclk, LOW);  // SCLK LOW
+  SSD1320_STAT(_stats.commandsSent++);
 
-    // Send command byte
-    _spi->beginTransaction(SPISettings(8000000, MSBFIRST, SPI_MODE0)); //Start up SPI again
-    _spi->transfer(cmd);
-    _spi->endTransaction();
+  PIN_WRITE(_cs, LOW);  // CS LOW
 
-    _spi->end(); //We have to stop the SPI hardware before we can bit bang the 9th bit
+  // Send D/C# bit
+  PIN_WRITE(_sd, SPI3_COMMAND); // Send command bit
+  PIN_WRITE(_sclk, HIGH); // SCLK HIGH - clock in on rising edge
+  PIN_WRITE(_sclk, LOW);  // SCLK LOW
 
-    digitalWrite(_cs, HIGH); // CS HIGH
+  // Send command byte
+  _spi->beginTransaction(_commandSettings); //Start up SPI again
+  _spi->transfer(cmd);
+  _spi->endTransaction();
 
-  } else if (_interface == OLED_INTERFACE_I2C) {
-    //! TODO
-  }
+  _spi->end(); //We have to stop the SPI hardware before we can bit bang the 9th bit
+
+  PIN_WRITE(_cs, HIGH); // CS HIGH
 }
 
 /** \brief Send the display a data byte
@@ -174,24 +335,210 @@ void SSD1320::command(uint8_t cmd) {
 */
 void SSD1320::data(uint8_t cmd) {
 
+  if (_interface != OLED_INTERFACE_SPI3) {
+    sendBlock(&cmd, 1, SPI3_DATA, false); //No 9th bit to bang
+    return;
+  }
+
+  if (_scrolling) scrollStop(); //Writing GDRAM while scrolling corrupts it
+
+  SSD1320_STAT(_stats.bytesSent++);
+
+  PIN_WRITE(_cs, LOW);  // CS LOW
+
+  // Send D/C# bit
+  PIN_WRITE(_sd, SPI3_DATA); // Send data bit
+  PIN_WRITE(_sclk, HIGH); // SCLK HIGH - clock in on rising edge
+  PIN_WRITE(_sclk, LOW);  // SCLK LOW
+
+  // Send data byte
+  _spi->beginTransaction(_dataSettings); //Start up SPI again
+  _spi->transfer(cmd);
+  _spi->endTransaction();
+
+  _spi->end(); //We have to stop the SPI hardware before we can bit bang the 9th bit
+
+  PIN_WRITE(_cs, HIGH); // CS HIGH
+}
+
+/** \brief Send the display a block of bytes in one burst
+
+  All bytes get the same D/C# bit (SPI3_COMMAND or SPI3_DATA) and CS stays low for the
+  whole block. Set progmem to true if buffer points into flash.
+*/
+void SSD1320::sendBlock(const uint8_t *buffer, uint16_t length, uint8_t dc, boolean progmem) {
+  startTransfer(dc);
+  transferBlock(buffer, length, dc, progmem);
+  endTransfer();
+}
+
+/** \brief Send a block of commands.
+    Send length command and argument bytes with CS held low for all of them.
+*/
+void SSD1320::writeCommands(const uint8_t *cmds, uint16_t length) {
+  sendBlock(cmds, length, SPI3_COMMAND, false);
+}
+
+/** \brief Send a block of GDRAM data.
+    Send length data bytes to the current column/row window with CS held low for all of them.
+*/
+void SSD1320::writeData(const uint8_t *data, uint16_t length) {
+  sendBlock(data, length, SPI3_DATA, false);
+}
+
+/** \brief Use 4-wire SPI.
+    Drive the D/C# line from dcPin instead of sending it as a 9th bit. Bytes then go out as
+    plain 8-bit SPI, SCLK and SDIN must be the hardware SPI pins. Call before begin().
+*/
+void SSD1320::setDCPin(uint8_t dcPin) {
+  _dc = dcPin;
+  _interface = OLED_INTERFACE_SPI4;
+}
+
+/** \brief Set SPI clocks.
+    SPI clock in Hz for commands and for GDRAM data. Leave dataClock at 0 to use commandClock
+    for both. Data is most of the traffic, so a long or noisy cable may only need the command
+    clock lowered, or only tolerate a fast data clock. Use selfTest() to find the fastest clean clock.
+*/
+void SSD1320::setSPIClock(uint32_t commandClock, uint32_t dataClock) {
+  if (dataClock == 0) dataClock = commandClock;
+  _commandSettings = SPISettings(commandClock, MSBFIRST, SPI_MODE0);
+  _dataSettings = SPISettings(dataClock, MSBFIRST, SPI_MODE0);
+}
+
+#ifdef SSD1320_ENABLE_I2C
+/** \brief Set I2C bus clock.
+    Clock in Hz for the I2C interface, 400000 by default. The SSD1320 is rated for 400kHz;
+    1000000 often works on short wires. Can be called before or after begin().
+*/
+void SSD1320::setI2CClock(uint32_t clock) {
+  _i2cClock = clock;
+  if (_interface == OLED_INTERFACE_I2C) _i2c->setClock(_i2cClock);
+}
+#endif
+
+// Select the display and start the SPI hardware for a burst of transferBlock()s with the same D/C#
+void SSD1320::startTransfer(uint8_t dc) {
+
+  if (dc == SPI3_DATA && _scrolling) scrollStop(); //Writing GDRAM while scrolling corrupts it
+
+  if (_interface == OLED_INTERFACE_SPI3 || _interface == OLED_INTERFACE_SPI4) {
+    if (_interface == OLED_INTERFACE_SPI4) PIN_WRITE(_dc, dc);
+
+    PIN_WRITE(_cs, LOW);  // CS LOW
+    _spi->beginTransaction((dc == SPI3_DATA) ? _dataSettings : _commandSettings);
+
+#ifdef SSD1320_ENABLE_I2C
+  } else if (_interface == OLED_INTERFACE_I2C) {
+    _i2cPending = 0; //transferBlock() opens a transmission when it has something to send
+#endif
+  }
+}
+
+/** \brief Clock out a block of bytes inside startTransfer()/endTransfer().
+
+  In 3-wire mode, rather than bit banging the 9th bit of every byte we pack eight 9-bit words
+  into nine 8-bit bytes and let the SPI hardware clock them out. A short last group is
+  padded with NOP commands so the controller never sees a partial word.
+  In 4-wire mode the bytes go out as they are.
+*/
+void SSD1320::transferBlock(const uint8_t *buffer, uint16_t length, uint8_t dc, boolean progmem) {
+
+#ifdef SSD1320_ENABLE_STATS
+  if (dc == SPI3_DATA) _stats.bytesSent += length;
+  else _stats.commandsSent += length;
+#endif
+
   if (_interface == OLED_INTERFACE_SPI3) {
-    digitalWrite(_cs, LOW);  // CS LOW
+    uint8_t packed[9];
+
+    while (length > 0)
+    {
+      uint8_t words = (length < 8) ? length : 8;
+      uint16_t bitBucket = 0;
+      uint8_t bitCount = 0;
+      uint8_t spot = 0;
+
+      for (uint8_t i = 0 ; i < 8 ; i++)
+      {
+        uint16_t word;
+        if (i < words)
+        {
+          uint8_t thing = progmem ? pgm_read_byte(buffer) : *buffer;
+          buffer++;
+          word = (dc == SPI3_DATA) ? (0x100 | thing) : thing;
+        }
+        else
+          word = NOP; //Pad with 9-bit NOP commands
+
+        bitBucket = (bitBucket << 9) | word;
+        bitCount += 9;
+        while (bitCount >= 8)
+        {
+          bitCount -= 8;
+          packed[spot++] = bitBucket >> bitCount;
+        }
+      }
 
-    // Send D/C# bit
-    digitalWrite(_sd, SPI3_DATA); // Send data bit
-    digitalWrite(_sclk, HIGH); // SCLK HIGH - clock in on rising edge
-    digitalWrite(_sclk, LOW);  // SCLK LOW
+      _spi->transfer(packed, 9);
+      length -= words;
+    }
+
+  } else if (_interface == OLED_INTERFACE_SPI4) {
+    uint8_t chunk[16]; //transfer() overwrites its buffer with what it reads back
+
+    while (length > 0)
+    {
+      uint8_t count = (length < sizeof(chunk)) ? length : sizeof(chunk);
+      if (progmem) memcpy_P(chunk, buffer, count);
+      else memcpy(chunk, buffer, count);
 
-    // Send data byte
-    _spi->beginTransaction(SPISettings(8000000, MSBFIRST, SPI_MODE0)); //Start up SPI again
-    _spi->transfer(cmd);
+      _spi->transfer(chunk, count);
+      buffer += count;
+      length -= count;
+    }
+
+#ifdef SSD1320_ENABLE_I2C
+  } else if (_interface == OLED_INTERFACE_I2C) {
+    //One control byte, then as many bytes as the Wire buffer has room for. A transmission
+    //carries on across transferBlock() calls until it is full or endTransfer() is called.
+    while (length > 0)
+    {
+      if (_i2cPending == 0)
+      {
+        _i2c->beginTransmission(_i2cAddress);
+        _i2c->write((dc == SPI3_DATA) ? I2C_CONTROL_DATA : I2C_CONTROL_COMMAND);
+      }
+
+      _i2c->write(progmem ? pgm_read_byte(buffer) : *buffer);
+      buffer++;
+      length--;
+
+      if (++_i2cPending == I2C_CHUNK_SIZE)
+      {
+        _i2c->endTransmission();
+        _i2cPending = 0;
+      }
+    }
+#endif
+  }
+}
+
+// Deselect the display after startTransfer()
+void SSD1320::endTransfer(void) {
+
+  if (_interface == OLED_INTERFACE_SPI3 || _interface == OLED_INTERFACE_SPI4) {
     _spi->endTransaction();
+    if (_interface == OLED_INTERFACE_SPI3)
+      _spi->end(); //Release the pins so command() and data() can bit bang the D/C# bit
 
-    _spi->end(); //We have to stop the SPI hardware before we can bit bang the 9th bit
+    PIN_WRITE(_cs, HIGH); // CS HIGH
 
-    digitalWrite(_cs, HIGH); // CS HIGH
+#ifdef SSD1320_ENABLE_I2C
   } else if (_interface == OLED_INTERFACE_I2C) {
-    //! TODO
+    if (_i2cPending) _i2c->endTransmission();
+    _i2cPending = 0;
+#endif
   }
 }
 
@@ -203,10 +550,11 @@ void SSD1320::data(uint8_t cmd) {
     pointer to row start address.
 */
 void SSD1320::setColumnAddress(uint8_t address) {
-  command(SETCOLUMN); // Set column address
-  command(address); //Set start address
-  command((_displayWidth / 2) - 1); //There are 160 pixels but each byte is 2 pixels. We want addresses 0 to 79.
-  return;
+  uint8_t cmds[3];
+  cmds[0] = SETCOLUMN; // Set column address
+  cmds[1] = address; //Set start address
+  cmds[2] = (SSD1320_WIDTH / 2) - 1; //There are 160 pixels but each byte is 2 pixels. We want addresses 0 to 79.
+  sendBlock(cmds, 3, SPI3_COMMAND, false);
 }
 
 /** \brief Set SSD1320 row address.
@@ -217,10 +565,38 @@ void SSD1320::setColumnAddress(uint8_t address) {
     pointer to row start address.
 */
 void SSD1320::setRowAddress(uint8_t address) {
-  command(SETROW); // Set row address
-  command(address); //Set start address
-  command(_displayHeight - 1); //Set end address: Display has 32 rows of pixels.
-  return;
+  uint8_t cmds[3];
+  cmds[0] = SETROW; // Set row address
+  cmds[1] = address; //Set start address
+  cmds[2] = SSD1320_HEIGHT - 1; //Set end address: Display has 32 rows of pixels.
+  sendBlock(cmds, 3, SPI3_COMMAND, false);
+}
+
+/** \brief Set SSD1320 column and row window.
+    Send both address commands in one burst. GDRAM data then fills startColumn to endColumn
+    (2 pixels per column) of startRow, then the next row up to endRow.
+*/
+void SSD1320::setWindow(uint8_t startColumn, uint8_t endColumn, uint8_t startRow, uint8_t endRow) {
+  uint8_t cmds[6];
+  cmds[0] = SETCOLUMN;
+  cmds[1] = startColumn;
+  cmds[2] = endColumn;
+  cmds[3] = SETROW;
+  cmds[4] = startRow;
+  cmds[5] = endRow;
+  sendBlock(cmds, 6, SPI3_COMMAND, false);
+}
+
+/** \brief Expand 1-bit pixels to GDRAM bytes.
+    Turn length pixel pairs of a 1bpp row (MSB is the left pixel), from the even pixel firstPixel
+    on, into length GDRAM bytes: 1 = 0x0F, the left pixel in the low nibble. Same as display().
+*/
+void SSD1320::expandBits(const uint8_t *bits, uint16_t firstPixel, uint8_t *gdram, uint8_t length) {
+  for (uint8_t i = 0 ; i < length ; i++, firstPixel += 2)
+  {
+    uint8_t pair = bits[firstPixel / 8] << (firstPixel % 8);
+    gdram[i] = ((pair & 0x80) ? 0x0F : 0) | ((pair & 0x40) ? 0xF0 : 0);
+  }
 }
 
 // Execute power up sequence as diagramed on page 11 of OLED datasheet
@@ -231,56 +607,37 @@ void SSD1320::powerUp() {
   digitalWrite(_rst, HIGH); // Set reset line high
   delayMicroseconds(3);
 
-  command(DISPLAYOFF);       // 0xAE - Display off
-
-  command(SETDISPLAYCLOCKDIV); // 0xD5 - Clock divide ratio/osc. freq
-  command(0xC2);                     // 0xC2 - osc clock=0xC divide ratio = 0x2
-
-  command(SETMULTIPLEX); // 0xA8 - Multiplex ratio
-  command(0x1F);                     // 0x1F - 31
-
-  command(SETDISPLAYOFFSET); // 0xD3 - Display offset
-  command(0x60);                          // 0x60 - 96
-
-  command(SETSTARTLINE); // 0xA2 - Start line
-  command(0x00);                      // 0x00 - Line 0
-
-  command(SETSEGREMAP);  // 0xA0 - Segment re-map
-
-  command(COMSCANINC); // 0xC0 - COM Output scan direction
-
-  command(SETCOMPINS); // 0xDA - seg pins hardware config
-  command(0x12);                       // 0x12 -
-
-  command(SETCONTRAST);    // 0x81 - Contrast control
-  command(0x5A);                       // 0x5A - value between 0x00 and 0xFF
-
-  command(SETPHASELENGTH); // 0xD9 - Pre-charge period
-  command(0x22);                       // 0x22
-
-  command(SETVCOMDESELECT);   // 0xDB - VCOMH Deselect level
-  command(0x30);                       // 0x30
-
-  command(SELECTIREF);     // 0xAD - Internal IREF Enable
-  command(0x10);                       // 0x10
-
-  command(MEMORYMODE); // 0x20 - Memory addressing mode
-  command(0x00);                        // 0x00 - Horizontal
-
-  // disable internal charge pump
-  command(SETCHARGEPMP1); // 0x8D - Internal charge pump
-  command(0x01);                           // 0x01
-  command(SETCHARGEPMP2); // 0xAC - Internal charge pump
-  command(0x00);                           // 0x00
-
-  // set entire display on/off
-  command(RESETALLON);      // 0xA4 - Display on
+  reinit();
+}
 
-  // set normal/inverse display
-  command(RESETINVERT);  // 0xA6 - Normal display (not inverted)
+/** \brief Re-initialize the display controller.
+  Streams the init sequence to the controller again without pulsing the reset line, then puts
+  back any contrast, flip and invert settings changed since begin(). Use this after a brown-out
+  or after the panel supply has been switched off. GDRAM contents are not restored; call
+  display() afterwards if the panel lost power.
+*/
+void SSD1320::reinit(void) {
+  sendBlock(_initSequence, _initLength, SPI3_COMMAND, true);
+
+  uint8_t cmds[5];
+  uint8_t count = 0;
+  if (_segRemap) cmds[count++] = _segRemap;
+  if (_comScan) cmds[count++] = _comScan;
+  if (_invertCmd) cmds[count++] = _invertCmd;
+  if (_contrastSet)
+  {
+    cmds[count++] = SETCONTRAST;
+    cmds[count++] = _contrast;
+  }
+  if (count) sendBlock(cmds, count, SPI3_COMMAND, false);
 
-  // display on
-  command(DISPLAYON);         // 0xAF - Display on
+  //The controller is back on its default gray scale table
+  uint8_t preset = _grayPreset;
+  uint8_t brightness = _grayBrightness;
+  _grayPreset = GRAYTABLE_DEFAULT;
+  if (preset == GRAYTABLE_CUSTOM) setGrayTable(_grayLevels);
+  else if (preset != GRAYTABLE_DEFAULT) setGrayTablePreset(preset);
+  if (brightness != 255) setGrayBrightness(brightness);
 
   //Set the row and column limits for this display
   //These commands also set the RAM pointer on the display to 0,0
@@ -288,52 +645,355 @@ void SSD1320::powerUp() {
   setRowAddress(0);
 }
 
+/** \brief Set the power up command sequence.
+  Point to a table of command bytes stored in PROGMEM. The table replaces the built in
+  sequence for the next begin() or reinit(). Call before begin(). If the table sets its own
+  contrast, pass the same value to setContrast() after begin() so fadeContrast() starts there.
+*/
+void SSD1320::setInitSequence(const uint8_t *sequence, uint8_t length) {
+  _initSequence = sequence;
+  _initLength = length;
+}
+
 /** \brief Invert display.
     The WHITE color of the display will turn to BLACK and the BLACK will turn to WHITE.
 */
 void SSD1320::invert(boolean inv) {
   if (inv)
-    command(INVERTDISPLAY);
+    _invertCmd = INVERTDISPLAY;
   else
-    command(RESETINVERT);
+    _invertCmd = RESETINVERT;
+  command(_invertCmd);
 }
 
 /** \brief Set contrast.
     OLED contract value from 0 to 255. Note: Contrast level is not very obvious.
 */
 void SSD1320::setContrast(uint8_t contrast) {
+  _contrast = contrast;
+  _contrastSet = true;
   command(SETCONTRAST); //0x81
   command(contrast);
 }
 
+/** \brief Set gray scale table.
+    Load the pulse widths for gray levels GS1 to GS15 (GS0 is always off). Values must not
+    decrease from one level to the next. Changing the table re-maps every pixel on the screen at
+    once, so fades and brightness curves don't need the GDRAM to be re-sent.
+    Loading a table resets the gray brightness to full.
+*/
+void SSD1320::setGrayTable(const uint8_t levels[15]) {
+  uint8_t cmds[16];
+  cmds[0] = SETGSTABLE; //0xBE
+  for (uint8_t x = 0 ; x < 15 ; x++)
+  {
+    cmds[x + 1] = levels[x];
+    _grayLevels[x] = levels[x];
+  }
+  sendBlock(cmds, 16, SPI3_COMMAND, false);
+  _grayPreset = GRAYTABLE_CUSTOM;
+  _grayBrightness = 255;
+}
+
+/** \brief Set gray scale table preset.
+    Load one of the built in gamma curves: GRAYTABLE_LINEAR, GRAYTABLE_GAMMA15, GRAYTABLE_GAMMA20
+    or GRAYTABLE_GAMMA25. Nothing is sent if the preset is already loaded at full brightness so
+    it is cheap to call every frame. After setGrayBrightness() or fadeGray() it is sent again,
+    which brings the brightness back to full. Returns false if the preset does not exist.
+*/
+boolean SSD1320::setGrayTablePreset(uint8_t preset) {
+  if (preset >= TOTALGRAYTABLES)
+    return false;
+
+  if (preset == _grayPreset && _grayBrightness == 255) return true; //Already loaded at full brightness
+
+  sendBlock(grayTablePresets[preset], 16, SPI3_COMMAND, true);
+  memcpy_P(_grayLevels, &grayTablePresets[preset][1], 15);
+  _grayPreset = preset;
+  _grayBrightness = 255;
+  return true;
+}
+
+/** \brief Restore the default gray scale table.
+    Switch the controller back to its built in linear gray scale table.
+*/
+void SSD1320::setDefaultGrayTable(void) {
+  command(SETDEFAULTTABLE); //0xBF
+  _grayPreset = GRAYTABLE_DEFAULT;
+  _grayBrightness = 255;
+}
+
+/** \brief Get gray scale table preset.
+    Returns the preset currently loaded, GRAYTABLE_CUSTOM after setGrayTable() or
+    GRAYTABLE_DEFAULT if the controller is using its built in table.
+*/
+uint8_t SSD1320::getGrayTablePreset(void) {
+  return _grayPreset;
+}
+
+/** \brief Set gray brightness.
+    Scale the loaded gray scale table from 0 (every pixel off) to 255 (table as loaded).
+    Unlike contrast this reaches all the way down to black. Costs one 16 byte command burst
+    and no GDRAM traffic. If the controller is on its default table the linear preset is
+    loaded first.
+*/
+void SSD1320::setGrayBrightness(uint8_t level) {
+  if (_grayPreset == GRAYTABLE_DEFAULT) setGrayTablePreset(GRAYTABLE_LINEAR);
+
+  uint8_t cmds[16];
+  cmds[0] = SETGSTABLE; //0xBE
+  for (uint8_t x = 0 ; x < 15 ; x++)
+    cmds[x + 1] = ((uint16_t)_grayLevels[x] * level + 127) / 255;
+  sendBlock(cmds, 16, SPI3_COMMAND, false);
+  _grayBrightness = level;
+}
+
+/** \brief Fade contrast.
+    Ramp the contrast from its current value to 'to' over duration milliseconds.
+    Call update() from loop() to run the fade. Each step is a two byte contrast command.
+    The fade starts from the last setContrast() value. Until then it assumes the contrast of
+    the built in init sequence, so with a table from setInitSequence() call setContrast() first.
+*/
+void SSD1320::fadeContrast(uint8_t to, uint16_t duration) {
+  startTransition(TRANSITION_CONTRAST, _contrastSet ? _contrast : DEFAULT_CONTRAST, to, duration);
+}
+
+/** \brief Fade gray brightness.
+    Ramp the gray brightness (see setGrayBrightness()) to 'to' over duration milliseconds.
+    Fading to 0 takes the whole screen to black without touching the GDRAM.
+    Call update() from loop() to run the fade.
+*/
+void SSD1320::fadeGray(uint8_t to, uint16_t duration) {
+  startTransition(TRANSITION_GRAY, _grayBrightness, to, duration);
+}
+
+/** \brief Blink display.
+    Turn the display off and on, period milliseconds per off/on cycle, count times.
+    A count of 0 blinks until stopTransition() is called. Call update() from loop().
+*/
+void SSD1320::blink(uint16_t period, uint8_t count) {
+  startTransition(TRANSITION_BLINK, 0, 0, period);
+  _transCount = count;
+  _transValue = 1; //Display is on
+}
+
+/** \brief Pulse contrast.
+    Sweep the contrast from low to high and back every period milliseconds until
+    stopTransition() is called. Call update() from loop().
+*/
+void SSD1320::pulse(uint8_t low, uint8_t high, uint16_t period) {
+  startTransition(TRANSITION_PULSE, low, high, period);
+  setContrast(low);
+}
+
+void SSD1320::startTransition(uint8_t type, uint8_t from, uint8_t to, uint16_t duration) {
+  stopTransition();
+
+  _transType = type;
+  _transFrom = from;
+  _transTo = to;
+  _transDuration = (duration > 0) ? duration : 1;
+  _transCount = 0;
+  _transValue = from;
+  _transStart = millis();
+}
+
+/** \brief Stop transition.
+    Stop the running transition where it is. A blinking display is turned back on.
+*/
+void SSD1320::stopTransition(void) {
+  if (_transType == TRANSITION_BLINK && _transValue == 0) command(DISPLAYON);
+  _transType = TRANSITION_NONE;
+}
+
+/** \brief Is a transition running.
+    Returns true while a fade, blink or pulse is in progress.
+*/
+boolean SSD1320::isTransitioning(void) {
+  return _transType != TRANSITION_NONE;
+}
+
+/** \brief Advance the running transition.
+    Call often from loop(). Never blocks and only sends the few command bytes needed when
+    the value actually changes. Returns true while a transition is still running.
+*/
+boolean SSD1320::update(void) {
+  if (_transType == TRANSITION_NONE) return false;
+
+  unsigned long elapsed = millis() - _transStart;
+  boolean done = false;
+  uint8_t value;
+
+  if (_transType == TRANSITION_BLINK)
+  {
+    unsigned long halfPeriod = (_transDuration / 2) ? (_transDuration / 2) : 1;
+    unsigned long phase = elapsed / halfPeriod;
+    if (_transCount && phase >= (unsigned long)_transCount * 2) done = true;
+    value = (done || (phase & 1)) ? 1 : 0; // 0 = off during first half of each cycle
+
+    if (value != _transValue) command(value ? DISPLAYON : DISPLAYOFF);
+  }
+  else
+  {
+    int16_t span = (int16_t)_transTo - _transFrom;
+
+    if (_transType == TRANSITION_PULSE)
+    {
+      uint16_t position = elapsed % _transDuration;
+      uint16_t half = _transDuration / 2;
+      uint16_t tri = (position <= half) ? position : _transDuration - position;
+      if (tri > half) tri = half; //Odd periods hold the top for one extra millisecond
+      value = _transFrom + (int32_t)span * tri / (half ? half : 1);
+    }
+    else if (elapsed >= _transDuration)
+    {
+      value = _transTo;
+      done = true;
+    }
+    else
+      value = _transFrom + (int32_t)span * (int32_t)elapsed / _transDuration;
+
+    if (value != _transValue)
+    {
+      if (_transType == TRANSITION_GRAY) setGrayBrightness(value);
+      else setContrast(value);
+    }
+  }
+
+  _transValue = value;
+  if (done) _transType = TRANSITION_NONE;
+  return !done;
+}
+
 /** \brief Transfer display memory.
     Bulk move the screen buffer to the SSD1320 controller's memory so that images/graphics
     drawn on the screen buffer will be displayed on the OLED.
 */
 void SSD1320::display(void) {
+  if (_band != NULL) return; //displayBanded() sends each band itself
+
+  SSD1320_STAT(beginFlush());
 
   //Return CGRAM pointer to 0,0
+  setWindow(0, SSD1320_WIDTH / 2 - 1, 0, SSD1320_HEIGHT - 1);
+
+  //Expand one row at a time and send the whole frame in a single burst
+  uint8_t rowBuffer[SSD1320_WIDTH / 2];
+  startTransfer(SPI3_DATA);
+
+  for (uint8_t rows = 0 ; rows < SSD1320_HEIGHT ; rows++)
+  {
+    //Because our scatch buffer is too small to contain 4-bit grayscale,
+    //we extrapolate 1 bit onto 4 bits so we pull in two bits to make a byte.
+    expandBits(screenMemory + (int)rows * SSD1320_STRIDE, 0, rowBuffer, sizeof(rowBuffer));
+    transferBlock(rowBuffer, sizeof(rowBuffer), SPI3_DATA, false);
+  }
+
+  endTransfer();
+
+  SSD1320_STAT(endFlush((unsigned long)SSD1320_WIDTH * SSD1320_HEIGHT));
+}
+
+/** \brief Render and transfer the display a band at a time in 4-bit gray.
+    draw is called once for every SSD1320_BAND_HEIGHT rows, top to bottom. While it runs, drawing
+    goes to a small 4bpp band instead of the screen buffer: pixels outside the band are dropped,
+    GRAY(n) colors keep all 16 levels and clearDisplay() only clears the band. The band is sent to
+    its GDRAM rows before the next one is drawn. The screen buffer is not used or changed.
+    draw must draw the same frame every time it is called. Cursor, color, draw mode and font are
+    put back before each call. It may skip anything outside top to top + rows - 1, and must not
+    call display() or displayBanded() (display() is ignored, so a replayed display list is fine).
+*/
+void SSD1320::displayBanded(SSD1320_BandCallback draw) {
+  uint8_t band[SSD1320_BAND_HEIGHT * (SSD1320_WIDTH / 2)];
+
+  SSD1320_STAT(beginFlush());
+
+  uint8_t startX = cursorX, startY = cursorY, startColor = foreColor, startMode = drawMode, startFont = fontType;
+
+  //The window wraps row by row, so each band carries on where the last one stopped
+  setWindow(0, SSD1320_WIDTH / 2 - 1, 0, SSD1320_HEIGHT - 1);
+
+  _band = band;
+  for (_bandTop = 0 ; _bandTop < SSD1320_HEIGHT ; _bandTop += _bandRows)
+  {
+    _bandRows = SSD1320_HEIGHT - _bandTop;
+    if (_bandRows > SSD1320_BAND_HEIGHT) _bandRows = SSD1320_BAND_HEIGHT;
+
+    memset(band, 0, sizeof(band));
+    cursorX = startX;
+    cursorY = startY;
+    foreColor = startColor;
+    drawMode = startMode;
+    setFontType(startFont);
+    draw(_bandTop, _bandRows);
+
+    startTransfer(SPI3_DATA);
+    transferBlock(band, _bandRows * (SSD1320_WIDTH / 2), SPI3_DATA, false);
+    endTransfer();
+  }
+  _band = NULL;
+
+  SSD1320_STAT(endFlush((unsigned long)SSD1320_WIDTH * SSD1320_HEIGHT));
+}
+
+// Gray level 0 to 15 of a color
+uint8_t SSD1320::grayLevel(uint8_t color) {
+  if (color == WHITE) return 0x0F;
+  if (color == BLACK) return 0;
+  return color & 0x0F;
+}
+
+// Draw one pixel, in screen buffer coordinates, into the band. Rows outside the band are dropped.
+void SSD1320::bandPixel(uint8_t x, uint8_t y, uint8_t level, uint8_t mode) {
+  uint8_t row = y - _bandTop;
+  if (row >= _bandRows) return;
+
+  uint8_t *spot = _band + row * (SSD1320_WIDTH / 2) + (x / 2);
+  uint8_t shift = (x & 1) ? 4 : 0; //The low nibble is the left pixel
+
+  if (mode == XOR)
+    *spot ^= 0x0F << shift;
+  else
+    *spot = (*spot & ~(0x0F << shift)) | (level << shift);
+}
+
+/** \brief Draw the bus self test pattern.
+    Write a test pattern straight to GDRAM at the current bus clocks: a full brightness border,
+    a 16 step gray ramp over the top half and a one pixel checkerboard over the bottom half.
+    A clock that is too fast shows up as speckles, wrong gray steps or a shifted picture.
+    The host VirtualSSD1320 gives a fixed frameChecksum() for it. display() puts the screen buffer back.
+*/
+void SSD1320::selfTest(void) {
+  uint8_t rowBuffer[SSD1320_WIDTH / 2];
+
   setColumnAddress(0);
   setRowAddress(0);
+  startTransfer(SPI3_DATA);
 
-  for (uint8_t rows = 0 ; rows < 32 ; rows++)
+  for (uint8_t y = 0 ; y < SSD1320_HEIGHT ; y++)
   {
-    for (uint8_t columns = 0 ; columns < 20 ; columns++)
+    for (uint8_t column = 0 ; column < SSD1320_WIDTH / 2 ; column++)
     {
-      uint8_t originalByte = screenMemory[(int)rows * 20 + columns];
-      for (uint8_t bitNumber = 8 ; bitNumber > 0 ; bitNumber -= 2)
+      uint8_t newByte;
+      if (y == 0 || y == SSD1320_HEIGHT - 1)
+        newByte = 0xFF; //Border
+      else if (y < SSD1320_HEIGHT / 2)
       {
-        uint8_t newByte = 0;
-        //Because our scatch buffer is too small to contain 4-bit grayscale,
-        //we extrapolate 1 bit onto 4 bits so we pull in two bits to make a byte.
-        //We look at each bit in the byte and change it to 0 = 0x00 and 1 = 0x0F.
-        if ( (originalByte & (1 << (bitNumber - 1))) != 0) newByte |= 0x0F;
-        if ( (originalByte & (1 << (bitNumber - 2))) != 0) newByte |= 0xF0;
-
-        data(newByte);
+        uint8_t level = (uint16_t)column * 32 / SSD1320_WIDTH; //Gray ramp, both pixels the same
+        newByte = level | (level << 4);
       }
+      else
+        newByte = (y & 1) ? 0x0F : 0xF0; //Checkerboard, the low nibble is the left pixel
+
+      if (column == 0) newByte |= 0x0F; //Border
+      if (column == SSD1320_WIDTH / 2 - 1) newByte |= 0xF0;
+
+      rowBuffer[column] = newByte;
     }
+    transferBlock(rowBuffer, sizeof(rowBuffer), SPI3_DATA, false);
   }
+
+  endTransfer();
 }
 
 /** \brief Override Arduino's Print.
@@ -353,7 +1013,7 @@ size_t SSD1320::write(uint8_t c) {
   {
     drawChar(cursorX, cursorY, c, foreColor, drawMode);
     cursorX += fontWidth + 1;
-    if ((cursorX > (_displayWidth - fontWidth)))
+    if ((cursorX > (getDisplayWidth() - fontWidth)))
     {
       cursorY += fontHeight;
       cursorX = 0;
@@ -587,73 +1247,242 @@ void  SSD1320::drawChar(uint8_t x, uint8_t y, uint8_t c) {
 void  SSD1320::drawChar(uint8_t x, uint8_t y, uint8_t c, uint8_t color, uint8_t mode) {
   // TODO - New routine to take font of any height, at the moment limited to font height in multiple of 8 pixels
 
-  uint8_t rowsToDraw, row, tempC;
-  uint8_t i, j, temp;
-  uint16_t charPerBitmapRow, charColPositionOnBitmap, charRowPositionOnBitmap, charBitmapStartPosition;
+  uint8_t rowsToDraw, row, cellWidth, blockWidth;
+  uint8_t i, j;
+  uint8_t block[8];
+  uint16_t charBitmapStartPosition;
 
   if ((c < fontStartChar) || (c > (fontStartChar + fontTotalChar - 1))) // no bitmap available for the required c
     return;
 
-  tempC = c - fontStartChar; //Turn user's character into a byte number
-
   // each row (in datasheet is called a page) is 8 bits high, 16 bit high character will have 2 rows to be drawn
   rowsToDraw = fontHeight / 8; // 8 is LCD's page size, see datasheet
   if (rowsToDraw < 1) rowsToDraw = 1;
 
-  // The following draw function can draw anywhere on the screen, but SLOW pixel by pixel draw
-  if (rowsToDraw == 1) {
-    for  (i = 0 ; i < fontWidth + 1 ; i++)
-    {
-      if (i == fontWidth) // this is done in a weird way because for 5x7 font, there is no margin, this code add a margin after col 5
-        temp = 0;
-      else
-        temp = pgm_read_byte(fontsPointer[fontType] + FONTHEADERSIZE + (tempC * fontWidth) + i);
-
-      //0x7F is the first vertical line of the lowercase letter h
-      //The fonts are coming in upside down?
-      temp = flipByte(temp);
+  if (rowsToDraw == 1)
+    cellWidth = fontWidth + 1; // for 5x7 font, there is no margin, this adds a blank column after col 5
+  else
+    cellWidth = fontWidth;
+  charBitmapStartPosition = charStart(c - fontStartChar);
 
-      //Step through this line of the character checking each bit and setting a pixel
-      for (j = 0 ; j < 8 ; j++)
-      {
-        if (temp & 0x01) {
-          setPixel(x + i, y + j, color, mode);
-        }
-        else {
-          setPixel(x + i, y + j, !color, mode);
-        }
+  // Each font byte is one column of 8 pixels with the top pixel in the MSB.
+  // Gather up to 8 columns into a block and blit it a row at a time rather than pixel by pixel.
+  for (row = 0 ; row < rowsToDraw ; row++) {
+    for (i = 0 ; i < cellWidth ; i += 8) {
+      blockWidth = cellWidth - i;
+      if (blockWidth > 8) blockWidth = 8;
 
-        temp >>= 1;
+      for (j = 0 ; j < 8 ; j++) {
+        if ((j < blockWidth) && (i + j < fontWidth))
+          block[j] = pgm_read_byte(fontsPointer[fontType] + FONTHEADERSIZE + (charBitmapStartPosition + i + j + (row * fontMapWidth)));
+        else
+          block[j] = 0; // Margin column
       }
+
+      //The large fonts store their bottom 8 rows first
+      blitBlock(x + i, y + ((rowsToDraw - 1 - row) * 8), block, blockWidth, color, mode);
     }
-    return;
   }
+}
+
+// Offset in the current font's bitmap of the first column of character number tempC
+uint16_t SSD1320::charStart(uint8_t tempC) {
+  uint16_t charPerBitmapRow, charColPositionOnBitmap, charRowPositionOnBitmap;
+
+  if (fontHeight / 8 <= 1)
+    return tempC * fontWidth;
 
   // Font height over 8 bit
   // Take character "0" ASCII 48 as example
   charPerBitmapRow = fontMapWidth / fontWidth; // 256/8 = 32 char per row
   charColPositionOnBitmap = tempC % charPerBitmapRow; // = 16
   charRowPositionOnBitmap = int(tempC / charPerBitmapRow); // = 1
-  charBitmapStartPosition = (charRowPositionOnBitmap * fontMapWidth * (fontHeight / 8)) + (charColPositionOnBitmap * fontWidth) ;
+  return (charRowPositionOnBitmap * fontMapWidth * (fontHeight / 8)) + (charColPositionOnBitmap * fontWidth);
+}
 
-  for (row = 0 ; row < rowsToDraw ; row++) {
-    for (i = 0 ; i < fontWidth ; i++) {
-      temp = pgm_read_byte(fontsPointer[fontType] + FONTHEADERSIZE + (charBitmapStartPosition + i + (row * fontMapWidth)));
+/** \brief Get a column of a character.
+    The 8 pixels of column (0 to getFontWidth() - 1) of character c in the current font. Fonts
+    taller than 8 pixels have getFontHeight() / 8 rows. drawChar() at x,y draws the MSB of
+    row r at y + (rows - 1 - r) * 8 and the LSB 7 pixels further. 0 for characters the font
+    doesn't have.
+*/
+uint8_t SSD1320::getCharColumn(uint8_t c, uint8_t column, uint8_t row) {
+  if ((c < fontStartChar) || (c > (fontStartChar + fontTotalChar - 1)) || (column >= fontWidth))
+    return 0;
+  if ((row > 0) && (row >= fontHeight / 8))
+    return 0;
 
-      //The fonts are coming in upside down
-      //Additionally, the large font #1 has padding at the (now) bottom that causes problems
-      //The fonts really need to be updated
-      temp = flipByte(temp);
+  return pgm_read_byte(fontsPointer[fontType] + FONTHEADERSIZE + (charStart(c - fontStartChar) + column + (row * fontMapWidth)));
+}
 
-      for (j = 0 ; j < 8 ; j++) {
-        if (temp & 0x01) {
-          setPixel(x + i, y + j + ((rowsToDraw - 1 - row) * 8), color, mode);
-        }
-        else {
-          setPixel(x + i, y + j + ((rowsToDraw - 1 - row) * 8), !color, mode);
+/** \brief Transpose an 8x8 bit matrix.
+    block[0..7] are rows with the leftmost pixel in the MSB. On return they are the columns,
+    top pixel in the MSB. The same call turns columns back into rows.
+    From Hacker's Delight, transpose8.
+*/
+void SSD1320::transpose8x8(uint8_t *block) {
+  uint32_t x, y, t;
+
+  x = ((uint32_t)block[0] << 24) | ((uint32_t)block[1] << 16) | ((uint32_t)block[2] << 8) | block[3];
+  y = ((uint32_t)block[4] << 24) | ((uint32_t)block[5] << 16) | ((uint32_t)block[6] << 8) | block[7];
+
+  t = (x ^ (x >> 7)) & 0x00AA00AA;  x = x ^ t ^ (t << 7);
+  t = (y ^ (y >> 7)) & 0x00AA00AA;  y = y ^ t ^ (t << 7);
+
+  t = (x ^ (x >> 14)) & 0x0000CCCC;  x = x ^ t ^ (t << 14);
+  t = (y ^ (y >> 14)) & 0x0000CCCC;  y = y ^ t ^ (t << 14);
+
+  t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+  y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+  x = t;
+
+  block[0] = x >> 24; block[1] = x >> 16; block[2] = x >> 8; block[3] = x;
+  block[4] = y >> 24; block[5] = y >> 16; block[6] = y >> 8; block[7] = y;
+}
+
+/** \brief Blit an 8 pixel tall block.
+    columns[0..width-1] are pixel columns (top pixel in the MSB) to draw at x,y in display
+    coordinates. When the display is rotated by 90 or 270 degrees the screen buffer is stored
+    transposed, so the columns are already buffer rows. Otherwise the block is transposed first.
+    Pixels are drawn like drawChar(): set bits in color, clear bits in the opposite color,
+    and in XOR mode every pixel of the block is inverted.
+*/
+void SSD1320::blitBlock(uint16_t x, uint16_t y, uint8_t *columns, uint8_t width, uint8_t color, uint8_t mode) {
+  uint8_t i;
+
+  if (_rotation & 1) {
+    for (i = 0 ; i < width ; i++)
+      blitRow(y, x + i, columns[i], 8, color, mode);
+  }
+  else {
+    transpose8x8(columns);
+    for (i = 0 ; i < 8 ; i++)
+      blitRow(x, y + i, columns[i], width, color, mode);
+  }
+}
+
+/** \brief Blit up to 8 pixels of one screen buffer row.
+    bits holds width pixels starting at the MSB. x,y are screen buffer coordinates.
+*/
+void SSD1320::blitRow(uint16_t x, uint16_t y, uint8_t bits, uint8_t width, uint8_t color, uint8_t mode) {
+  if ((x >= _displayWidth) || (y >= _displayHeight))
+    return;
+
+  if (width > _displayWidth - x) width = _displayWidth - x;
+
+  if (_band != NULL)
+  {
+    uint8_t level = grayLevel(color);
+    uint8_t background = (color == BLACK) ? 0x0F : 0;
+    for (uint8_t i = 0 ; i < width ; i++)
+      bandPixel(x + i, y, (bits & (0x80 >> i)) ? level : background, mode);
+    return;
+  }
+
+  if (color > WHITE) color = (color >= GRAY(8)) ? WHITE : BLACK;
+
+  uint8_t mask = 0xFF << (8 - width);
+  if (mode != XOR)
+  {
+    if (color == WHITE) bits &= mask;
+    else if (color == BLACK) bits = ~bits & mask;
+    else bits = 0;
+  }
+
+  uint8_t *spot = screenMemory + y * SSD1320_STRIDE + (x / 8);
+  uint8_t shift = x % 8;
+
+  if (mode == XOR)
+    spot[0] ^= mask >> shift;
+  else
+    spot[0] = (spot[0] & ~(mask >> shift)) | (bits >> shift);
+
+  // Pixels that spill into the next byte
+  if (shift && ((x / 8) + 1 < SSD1320_STRIDE))
+  {
+    if (mode == XOR)
+      spot[1] ^= mask << (8 - shift);
+    else
+      spot[1] = (spot[1] & ~(uint8_t)(mask << (8 - shift))) | (uint8_t)(bits << (8 - shift));
+  }
+}
+
+/** \brief Draw 1-bit rows.
+    bits holds height rows of width pixels, (width + 7) / 8 bytes each with the leftmost pixel
+    in the MSB. Row r is drawn at y + r from x to the right, like drawChar() draws: set bits in
+    color, clear bits in the opposite color, and in XOR mode every pixel is inverted. Pixels
+    past coordinate 255 are dropped, where drawChar() would wrap them around. Unrotated,
+    each byte is a masked store or two into the screen buffer. Rotated by 90 or 270 degrees the
+    rows are transposed 8 at a time.
+*/
+void SSD1320::drawBits(uint8_t x, uint8_t y, const uint8_t *bits, uint8_t width, uint8_t height, uint8_t color, uint8_t mode) {
+  uint8_t stride = (width + 7) / 8;
+
+  if ((_rotation & 1) == 0 && _band == NULL) {
+    if ((x >= _displayWidth) || (y >= _displayHeight))
+      return;
+    if (width > _displayWidth - x) width = _displayWidth - x;
+    if (height > _displayHeight - y) height = _displayHeight - y;
+
+    //What blitRow() does to each byte, worked out once
+    if (color > WHITE) color = (color >= GRAY(8)) ? WHITE : BLACK;
+    uint8_t flip = (color == BLACK) ? 0xFF : 0;
+    uint8_t shift = x % 8;
+    uint8_t bytes = (width + 7) / 8;
+    uint8_t lastMask = 0xFF << (bytes * 8 - width);
+
+    for (uint8_t row = 0 ; row < height ; row++) {
+      uint8_t *spot = screenMemory + (y + row) * SSD1320_STRIDE + (x / 8);
+      uint8_t *end = screenMemory + (y + row + 1) * SSD1320_STRIDE;
+
+      for (uint8_t i = 0 ; i < bytes ; i++) {
+        uint8_t mask = (i == bytes - 1) ? lastMask : 0xFF;
+        uint8_t pixels = (mode == XOR) ? mask : (bits[i] ^ flip) & mask;
+
+        if (mode == XOR)
+          spot[i] ^= mask >> shift;
+        else
+          spot[i] = (spot[i] & ~(mask >> shift)) | (pixels >> shift);
+
+        // Pixels that spill into the next byte
+        if (shift && (spot + i + 1 < end)) {
+          if (mode == XOR)
+            spot[i + 1] ^= (uint8_t)(mask << (8 - shift));
+          else
+            spot[i + 1] = (spot[i + 1] & ~(uint8_t)(mask << (8 - shift))) | (uint8_t)(pixels << (8 - shift));
         }
-        temp >>= 1;
       }
+      bits += stride;
+    }
+    return;
+  }
+
+  if ((_rotation & 1) == 0) {
+    for (uint8_t row = 0 ; row < height ; row++) {
+      for (uint8_t i = 0 ; i < stride ; i++) {
+        uint8_t pixels = width - i * 8;
+        blitRow(x + i * 8, (uint16_t)y + row, bits[i], (pixels > 8) ? 8 : pixels, color, mode);
+      }
+      bits += stride;
+    }
+    return;
+  }
+
+  //8x8 tiles turned into columns, which are screen buffer rows in this rotation
+  uint8_t block[8];
+  for (uint8_t row = 0 ; row < height ; row += 8) {
+    uint8_t rows = height - row;
+    if (rows > 8) rows = 8;
+
+    for (uint8_t i = 0 ; i < stride ; i++) {
+      for (uint8_t j = 0 ; j < 8 ; j++)
+        block[j] = (j < rows) ? bits[(row + j) * stride + i] : 0;
+      transpose8x8(block);
+
+      uint8_t pixels = width - i * 8;
+      if (pixels > 8) pixels = 8;
+      for (uint8_t j = 0 ; j < pixels ; j++)
+        blitRow((uint16_t)y + row, x + i * 8 + j, block[j], rows, color, mode);
     }
   }
 }
@@ -662,11 +1491,280 @@ void  SSD1320::drawChar(uint8_t x, uint8_t y, uint8_t c, uint8_t color, uint8_t
   Draw Bitmap image on screen. The array for the bitmap can be stored in the Arduino file, 
   so user don't have to mess with the library files.
   To use, create uint8_t array that is 160x32 pixels (640 bytes). Then call .drawBitmap and pass it the array.
+  When rotated by 90 or 270 degrees the array is 32x160 pixels and is transposed into the
+  screen buffer 8x8 pixels at a time.
 */
 void SSD1320::drawBitmap(uint8_t * bitArray)
 {
-  for (int i = 0; i < (_displayWidth * _displayHeight / 8); i++)
-    screenMemory[i] = bitArray[i];
+  if (_band != NULL)
+  {
+    for (uint8_t y = _bandTop ; y < _bandTop + _bandRows ; y++)
+    {
+      for (uint8_t x = 0 ; x < SSD1320_WIDTH ; x++)
+      {
+        uint8_t bits;
+        if (_rotation & 1)
+          bits = bitArray[x * (SSD1320_HEIGHT / 8) + (y / 8)] << (y % 8);
+        else
+          bits = bitArray[y * SSD1320_STRIDE + (x / 8)] << (x % 8);
+        bandPixel(x, y, (bits & 0x80) ? 0x0F : 0, NORM);
+      }
+    }
+    return;
+  }
+
+  if ((_rotation & 1) == 0)
+  {
+    memcpy(screenMemory, bitArray, SSD1320_BUFFERSIZE);
+    return;
+  }
+
+  uint8_t block[8];
+  const uint8_t bitmapStride = SSD1320_HEIGHT / 8; // Bytes per row of the rotated bitmap
+
+  for (uint8_t blockRow = 0 ; blockRow < SSD1320_STRIDE ; blockRow++)
+  {
+    for (uint8_t blockColumn = 0 ; blockColumn < bitmapStride ; blockColumn++)
+    {
+      for (uint8_t i = 0 ; i < 8 ; i++)
+        block[i] = bitArray[(blockRow * 8 + i) * bitmapStride + blockColumn];
+
+      transpose8x8(block);
+
+      for (uint8_t i = 0 ; i < 8 ; i++)
+        screenMemory[(blockColumn * 8 + i) * SSD1320_STRIDE + blockRow] = block[i];
+    }
+  }
+}
+
+/** \brief Draw a gray image.
+    Draw a width x height gray image from PROGMEM with its first row at x,y. With 4 bits per
+    pixel, two pixels share a byte with the left one in the low nibble, like GDRAM and the
+    arrays in Example2_Graphics. With 8 bits per pixel each byte is one pixel.
+    The screen buffer only has black and white, so the image is dithered with DITHER_FLOYD,
+    DITHER_BAYER or DITHER_NONE (a plain threshold). Inside displayBanded() it is dithered
+    to the 16 gray levels instead.
+*/
+void SSD1320::drawGrayImage(uint8_t x, uint8_t y, uint8_t width, uint8_t height, const uint8_t *image,
+                            uint8_t bitsPerPixel, uint8_t dither) {
+  SSD1320_Dither ditherer(dither);
+  ditherer.begin((_band != NULL) ? 16 : 2);
+
+  uint16_t stride = (bitsPerPixel == 8) ? width : (width + 1) / 2;
+
+  for (uint8_t row = 0 ; row < height ; row++)
+    drawGrayRow(x, y + row, image + row * stride, width, bitsPerPixel, true, ditherer);
+}
+
+// Dither one row of 4 or 8 bit gray pixels into the screen buffer, or the band
+void SSD1320::drawGrayRow(uint8_t x, uint8_t y, const uint8_t *row, uint8_t width, uint8_t bitsPerPixel,
+                          boolean progmem, SSD1320_Dither &dither) {
+  dither.nextRow();
+
+  for (uint8_t column = 0 ; column < width ; column++)
+  {
+    uint8_t gray;
+    if (bitsPerPixel == 8)
+      gray = progmem ? pgm_read_byte(row + column) : row[column];
+    else
+    {
+      uint8_t pair = progmem ? pgm_read_byte(row + column / 2) : row[column / 2];
+      gray = ((column & 1) ? (pair >> 4) : (pair & 0x0F)) * 17;
+    }
+
+    uint8_t level = dither.pixel(x + column, gray);
+    if (_band != NULL)
+      setPixel(x + column, y, GRAY(level), NORM);
+    else
+      setPixel(x + column, y, level ? WHITE : BLACK, NORM);
+  }
+}
+
+/** \brief Draw a compressed image.
+    Draw an image made by extras/tools/ssd1320_image.py (see SSD1320_Image.h) into the screen
+    buffer with its bottom row at x,y. 1-bit images are copied, set bits WHITE and clear bits
+    BLACK. 4-bit images are dithered like drawGrayImage(). Returns false if image isn't valid.
+*/
+boolean SSD1320::drawImage(const uint8_t *image, uint8_t x, uint8_t y) {
+  SSD1320_ImageReader reader(image);
+  if (!reader.isValid()) return false;
+
+  uint8_t width = reader.getWidth();
+  uint8_t stride = reader.getStride();
+  uint8_t row[SSD1320_WIDTH / 2];
+
+  SSD1320_Dither dither(DITHER_FLOYD);
+  dither.begin((_band != NULL) ? 16 : 2);
+
+  for (uint8_t rowNumber = 0 ; rowNumber < reader.getHeight() ; rowNumber++)
+  {
+    reader.read(row, stride);
+
+    if (reader.getBitsPerPixel() == 4)
+      drawGrayRow(x, y + rowNumber, row, width, 4, false, dither);
+    else if (_rotation & 1)
+    {
+      for (uint8_t column = 0 ; column < width ; column++)
+        setPixel(x + column, y + rowNumber, (row[column / 8] & (0x80 >> (column % 8))) ? WHITE : BLACK, NORM);
+    }
+    else
+    {
+      //A byte at a time. blitRow() clips and handles any alignment.
+      for (uint8_t i = 0 ; i < stride ; i++)
+      {
+        uint8_t bits = width - i * 8;
+        blitRow(x + i * 8, y + rowNumber, row[i], (bits > 8) ? 8 : bits, WHITE, NORM);
+      }
+    }
+  }
+  return true;
+}
+
+/** \brief Display a compressed image.
+    Write an image made by extras/tools/ssd1320_image.py (see SSD1320_Image.h) straight into
+    GDRAM with its bottom row at x,y, in full gray for 4-bit images. x is rounded down to an
+    even column. The screen buffer is not changed, display() draws over the image.
+    Returns false if image isn't valid.
+*/
+boolean SSD1320::displayImage(const uint8_t *image, uint8_t x, uint8_t y) {
+  SSD1320_ImageReader reader(image);
+  if (!reader.isValid()) return false;
+  if (x >= SSD1320_WIDTH || y >= SSD1320_HEIGHT) return true;
+
+  uint8_t stride = reader.getStride();
+  uint8_t startColumn = x / 2;
+  uint8_t columns = ((uint16_t)reader.getWidth() + 1) / 2; //GDRAM bytes per row
+  if (columns > SSD1320_WIDTH / 2 - startColumn) columns = SSD1320_WIDTH / 2 - startColumn;
+  uint8_t rows = reader.getHeight();
+  if (rows > SSD1320_HEIGHT - y) rows = SSD1320_HEIGHT - y;
+
+  setWindow(startColumn, startColumn + columns - 1, y, y + rows - 1);
+
+  uint8_t row[SSD1320_WIDTH / 2];
+  uint8_t rowBuffer[SSD1320_WIDTH / 2];
+
+  startTransfer(SPI3_DATA);
+  for (uint8_t rowNumber = 0 ; rowNumber < rows ; rowNumber++)
+  {
+    reader.read(row, stride);
+
+    if (reader.getBitsPerPixel() == 4)
+      transferBlock(row, columns, SPI3_DATA, false);
+    else
+    {
+      expandBits(row, 0, rowBuffer, columns);
+      transferBlock(rowBuffer, columns, SPI3_DATA, false);
+    }
+  }
+  endTransfer();
+
+  return true;
+}
+
+/** \brief Draw a compressed image shrunk to fit a box.
+    As drawImage(), but an image bigger than width x height is shrunk, keeping its shape,
+    until it fits, and centered in the box with its bottom left corner at x,y. scaling is
+    SCALE_BOX or SCALE_NEAREST, see SSD1320_Scaler.h. Shrunk 1-bit images turn gray and are
+    dithered too.
+*/
+boolean SSD1320::drawImage(const uint8_t *image, uint8_t x, uint8_t y, uint8_t width, uint8_t height,
+                           uint8_t scaling) {
+  SSD1320_ImageReader reader(image);
+  if (!reader.isValid()) return false;
+
+  SSD1320_Scaler scaler(scaling);
+  beginScaledImage(reader, scaler, x, y, width, height);
+
+  uint8_t row[SSD1320_WIDTH / 2];
+  SSD1320_Dither dither(DITHER_FLOYD);
+  dither.begin((_band != NULL) ? 16 : 2);
+
+  for (uint8_t rowNumber = 0 ; rowNumber < scaler.getHeight() ; rowNumber++)
+  {
+    scaleImageRow(reader, scaler, row);
+    dither.nextRow();
+
+    for (uint8_t column = 0 ; column < scaler.getWidth() ; column++)
+    {
+      uint8_t level = dither.pixel(x + column, scaler.get(column));
+      if (_band != NULL)
+        setPixel(x + column, y + rowNumber, GRAY(level), NORM);
+      else
+        setPixel(x + column, y + rowNumber, level ? WHITE : BLACK, NORM);
+    }
+  }
+  return true;
+}
+
+/** \brief Display a compressed image shrunk to fit a box.
+    As displayImage(), but an image bigger than width x height is shrunk, keeping its shape,
+    until it fits, and centered in the box with its bottom left corner at x,y. scaling is
+    SCALE_BOX or SCALE_NEAREST, see SSD1320_Scaler.h. Shrunk 1-bit images turn gray.
+*/
+boolean SSD1320::displayImage(const uint8_t *image, uint8_t x, uint8_t y, uint8_t width, uint8_t height,
+                              uint8_t scaling) {
+  SSD1320_ImageReader reader(image);
+  if (!reader.isValid()) return false;
+
+  SSD1320_Scaler scaler(scaling);
+  beginScaledImage(reader, scaler, x, y, width, height);
+  x &= ~1;
+  if (x >= SSD1320_WIDTH || y >= SSD1320_HEIGHT) return true;
+
+  uint8_t startColumn = x / 2;
+  uint8_t columns = ((uint16_t)scaler.getWidth() + 1) / 2; //GDRAM bytes per row
+  if (columns > SSD1320_WIDTH / 2 - startColumn) columns = SSD1320_WIDTH / 2 - startColumn;
+  uint8_t rows = scaler.getHeight();
+  if (rows > SSD1320_HEIGHT - y) rows = SSD1320_HEIGHT - y;
+
+  setWindow(startColumn, startColumn + columns - 1, y, y + rows - 1);
+
+  uint8_t row[SSD1320_WIDTH / 2];
+
+  startTransfer(SPI3_DATA);
+  for (uint8_t rowNumber = 0 ; rowNumber < rows ; rowNumber++)
+  {
+    scaleImageRow(reader, scaler, row);
+
+    //Round to the 16 gray levels, the left pixel in the low nibble
+    for (uint8_t i = 0 ; i < columns ; i++)
+    {
+      uint8_t left = ((uint16_t)scaler.get(i * 2) * 15 + 127) / 255;
+      uint8_t right = ((uint16_t)scaler.get(i * 2 + 1) * 15 + 127) / 255;
+      row[i] = left | (right << 4);
+    }
+    transferBlock(row, columns, SPI3_DATA, false);
+  }
+  endTransfer();
+
+  return true;
+}
+
+// Start scaling an image into a width x height box at x,y. Moves x,y to center the result.
+void SSD1320::beginScaledImage(SSD1320_ImageReader &reader, SSD1320_Scaler &scaler, uint8_t &x, uint8_t &y,
+                               uint8_t width, uint8_t height) {
+  if (width > SSD1320_WIDTH) width = SSD1320_WIDTH;
+  uint8_t fittedWidth = width, fittedHeight = height;
+  SSD1320_Scaler::fit(reader.getWidth(), reader.getHeight(), fittedWidth, fittedHeight);
+  scaler.begin(reader.getWidth(), reader.getHeight(), fittedWidth, fittedHeight);
+
+  x += (width - scaler.getWidth()) / 2;
+  y += (height - scaler.getHeight()) / 2;
+}
+
+// Feed image rows to the scaler until it has an output row. row is scratch space.
+void SSD1320::scaleImageRow(SSD1320_ImageReader &reader, SSD1320_Scaler &scaler, uint8_t *row) {
+  do
+  {
+    reader.read(row, reader.getStride());
+    for (uint8_t column = 0 ; column < reader.getWidth() ; column++)
+    {
+      if (reader.getBitsPerPixel() == 4)
+        scaler.pixel(((column & 1) ? (row[column / 2] >> 4) : (row[column / 2] & 0x0F)) * 17);
+      else
+        scaler.pixel((row[column / 8] & (0x80 >> (column % 8))) ? 255 : 0);
+    }
+  } while (!scaler.endRow());
 }
 
 /** \brief Draw pixel.
@@ -680,10 +1778,22 @@ void SSD1320::setPixel(uint8_t x, uint8_t y) {
   Draw color pixel in the screen buffer's x,y position with NORM or XOR draw mode.
 */
 void SSD1320::setPixel(uint8_t x, uint8_t y, uint8_t color, uint8_t mode) {
-  if ((x < 0) || (x >= _displayWidth) || (y < 0) || (y >= _displayHeight))
+  SSD1320_PIXEL_HOOK();
+
+  if (_rotation & 1) swap(x, y); // 90 and 270 degrees are stored transposed
+
+  if ((x >= _displayWidth) || (y >= _displayHeight))
+    return;
+
+  if (_band != NULL)
+  {
+    bandPixel(x, y, grayLevel(color), mode);
     return;
+  }
 
-  int byteNumber = y * (_displayWidth / 8) + (x / 8);
+  if (color > WHITE) color = (color >= GRAY(8)) ? WHITE : BLACK;
+
+  int byteNumber = y * SSD1320_STRIDE + (x / 8);
 
   if (mode == XOR)
   {
@@ -709,6 +1819,12 @@ void SSD1320::setPixel(uint8_t x, uint8_t y, uint8_t color, uint8_t mode) {
 */
 void SSD1320::clearDisplay(uint8_t mode)
 {
+  if (_band != NULL) //In displayBanded() every mode clears just the band
+  {
+    memset(_band, 0, _bandRows * (SSD1320_WIDTH / 2));
+    return;
+  }
+
   if (mode == CLEAR_DISPLAY || mode == CLEAR_ALL) //Clear the RAM on the display
   {
     //Return CGRAM pointer to 0,0
@@ -719,15 +1835,19 @@ void SSD1320::clearDisplay(uint8_t mode)
     //Each byte paints two sequential pixels
     //Each 4-bit nibble is the 4-bit grayscale for that pixel
     //There are only 80 columns because each byte has 2 pixels
-    for (int rows = 0 ; rows < _displayHeight ; rows++)
-      for (int columns = 0 ; columns < (_displayWidth / 2) ; columns++)
-        data(0x00);
+    uint8_t rowBuffer[SSD1320_WIDTH / 2];
+    memset(rowBuffer, 0, sizeof(rowBuffer));
+
+    startTransfer(SPI3_DATA);
+    for (int rows = 0 ; rows < SSD1320_HEIGHT ; rows++)
+      transferBlock(rowBuffer, sizeof(rowBuffer), SPI3_DATA, false);
+    endTransfer();
 
-    if (mode == CLEAR_ALL) memset(screenMemory, 0, (_displayHeight * _displayWidth / 8)); //Clear the local buffer as well
+    if (mode == CLEAR_ALL) memset(screenMemory, 0, SSD1320_BUFFERSIZE); //Clear the local buffer as well
   }
   else //Clear the local buffer
   {
-    memset(screenMemory, 0, (_displayHeight * _displayWidth / 8));   // (32 x 160/8) = 640 bytes in the screenMemory buffer
+    memset(screenMemory, 0, SSD1320_BUFFERSIZE);   // (32 x 160/8) = 640 bytes in the screenMemory buffer
   }
 }
 
@@ -741,22 +1861,25 @@ void SSD1320::setCursor(uint8_t x, uint8_t y) {
 
 /** \brief Set the display height.
     Set the height of the display. This will affect the setPixel function.
+    Limited to SSD1320_HEIGHT, the height the screen buffer is built for.
 */
 void SSD1320::setDisplayHeight(uint16_t H) {
-  _displayHeight = H;
+  _displayHeight = (H < SSD1320_HEIGHT) ? H : SSD1320_HEIGHT;
 }
 
 /** \brief Set the display width.
     Set the width of the display. This will affect the setPixel function.
+    Limited to SSD1320_WIDTH, the width the screen buffer is built for.
 */
 void SSD1320::setDisplayWidth(uint16_t W) {
-  _displayWidth = W;
+  _displayWidth = (W < SSD1320_WIDTH) ? W : SSD1320_WIDTH;
 }
 
 /** \brief Get display height.
     The height of the display returned as int.
 */
 uint16_t SSD1320::getDisplayHeight(void) {
+  if (_rotation & 1) return _displayWidth;
   return _displayHeight;
 }
 
@@ -764,11 +1887,13 @@ uint16_t SSD1320::getDisplayHeight(void) {
     The width of the display returned as int.
 */
 uint16_t SSD1320::getDisplayWidth(void) {
+  if (_rotation & 1) return _displayHeight;
   return _displayWidth;
 }
 
 /** \brief Set color.
-    Set the current draw's color. Only WHITE and BLACK available.
+    Set the current draw's color: WHITE, BLACK or GRAY(0) to GRAY(15). Gray needs displayBanded(),
+    the screen buffer shows GRAY(8) and up as WHITE and the rest as BLACK.
 */
 void SSD1320::setColor(uint8_t color) {
   foreColor = color;
@@ -830,7 +1955,7 @@ uint8_t SSD1320::getFontType(void) {
     Set the current font type number, ie changing to different fonts base on the type provided.
 */
 boolean SSD1320::setFontType(uint8_t type) {
-  if ((type >= TOTALFONTS) || (type < 0))
+  if (type >= TOTALFONTS)
     return false;
 
   fontType = type;
@@ -856,92 +1981,163 @@ uint8_t SSD1320::getFontTotalChar(void) {
   return fontTotalChar;
 }
 
-/** \brief Right scrolling.
-  Set row start to row stop on the OLED to scroll right.
+/** \brief Horizontal scrolling.
+  Continuously scroll rows startRow to endRow, GDRAM columns startColumn to endColumn
+  (each column is two pixels, 0 to 79), one column every interval frames (SCROLL_2FRAMES
+  to SCROLL_256FRAMES). direction is SCROLL_RIGHT or SCROLL_LEFT.
 
-  Scrolling in not documented for the SSD1320 but I stumbled on
-  some interesting behavior. scrollRight does nothing (but is documented
-  in SSD1306). scrollLeft is the one that does weird stuff.
+  The controller moves the GDRAM itself, so a marquee costs no CPU or bus time per step:
+  draw the text, call display(), then start the scroll. Scrolling really shifts the GDRAM;
+  the next display() or other GDRAM write stops the scroll first and rewrites the memory.
+
+  Scrolling is not documented for the SSD1320. The byte layout follows the SSD1306/SSD1309
+  family with rows in place of pages.
 */
-void SSD1320::scrollRight(uint8_t start, uint8_t stop) {
-  if (stop < start) // stop must be larger or equal to start
+void SSD1320::scrollHorizontal(uint8_t direction, uint8_t startRow, uint8_t endRow,
+                               uint8_t startColumn, uint8_t endColumn, uint8_t interval) {
+  if (endRow < startRow || endColumn < startColumn) // end must be larger or equal to start
     return;
-  scrollStop();   // need to disable scrolling before starting to avoid memory corruption
-  command(RIGHTHORIZONTALSCROLL);
-  command(0x00); //Byte A - Dummy 0x00
-  command(start); //Byte B - Define start page address
-  command(0x07); //Byte C - Set scroll speed to 2 frames (time interval in number of frames 5/64/128/256/3/4/25/2)
-  command(stop); //Byte D - Define end page address
-  command(0x00); //Byte E - Dummy 0x00
-  command(0xFF); //Byte F - Dummy 0xFF
-  command(ACTIVATESCROLL);
+
+  scrollStop(); // Must disable scrolling before starting to avoid memory corruption
+
+  uint8_t cmds[8];
+  cmds[0] = (direction == SCROLL_LEFT) ? LEFTHORIZONTALSCROLL : RIGHTHORIZONTALSCROLL;
+  cmds[1] = 0x00; //Byte A - Dummy 0x00
+  cmds[2] = startRow; //Byte B - Start row
+  cmds[3] = interval & 0x07; //Byte C - Time interval between steps, in frames
+  cmds[4] = endRow; //Byte D - End row
+  cmds[5] = startColumn; //Byte E - Start column
+  cmds[6] = endColumn; //Byte F - End column
+  cmds[7] = ACTIVATESCROLL;
+  sendBlock(cmds, 8, SPI3_COMMAND, false);
+
+  _scrolling = true;
 }
 
-/** \brief Left scrolling.
-  Set row start to row stop on the OLED to scroll left.
+/** \brief Vertical and horizontal scrolling.
+  Scroll rows startRow to endRow sideways (SCROLL_RIGHT or SCROLL_LEFT) while the whole
+  display moves up by verticalOffset rows each step, one step every interval frames.
 */
-void SSD1320::scrollLeft(uint8_t start, uint8_t stop) {
-  if (stop < start) // Stop must be larger or equal to start
+void SSD1320::scrollDiagonal(uint8_t direction, uint8_t startRow, uint8_t endRow,
+                             uint8_t verticalOffset, uint8_t interval) {
+  if (endRow < startRow) // end must be larger or equal to start
     return;
 
-  scrollStop();   // Must disable scrolling before starting to avoid memory corruption
-
-  command(LEFTHORIZONTALSCROLL);
-  command(0x00); //Dummy byte
-  command(0x00); //Dummy byte
-  command(start); //Define starting page address
-
-  command(32); //Number of rows to scroll. You scan scroll part of the display
+  scrollStop(); // Must disable scrolling before starting to avoid memory corruption
+
+  uint8_t cmds[10];
+  cmds[0] = SETVERTICALSCROLLAREA;
+  cmds[1] = 0x00; //Byte A - Rows in top fixed area
+  cmds[2] = _displayHeight; //Byte B - Rows in scroll area
+  cmds[3] = (direction == SCROLL_LEFT) ? VERTICALLEFTHORIZONTALSCROLL : VERTICALRIGHTHORIZONTALSCROLL;
+  cmds[4] = 0x00; //Byte A - Dummy 0x00
+  cmds[5] = startRow; //Byte B - Start row
+  cmds[6] = interval & 0x07; //Byte C - Time interval between steps, in frames
+  cmds[7] = endRow; //Byte D - End row
+  cmds[8] = verticalOffset; //Byte E - Vertical scrolling offset
+  cmds[9] = ACTIVATESCROLL;
+  sendBlock(cmds, 10, SPI3_COMMAND, false);
+
+  _scrolling = true;
+}
 
-  command(stop); //Define end page address
-  command(0x00);
-  command(0xFF); //Speed?
-  command(ACTIVATESCROLL);
+/** \brief Right scrolling.
+  Set row start to row stop on the OLED to scroll right.
+*/
+void SSD1320::scrollRight(uint8_t start, uint8_t stop) {
+  scrollHorizontal(SCROLL_RIGHT, start, stop, 0, (_displayWidth / 2) - 1, SCROLL_2FRAMES);
 }
 
 /** \brief Left scrolling.
   Set row start to row stop on the OLED to scroll left.
+*/
+void SSD1320::scrollLeft(uint8_t start, uint8_t stop) {
+  scrollHorizontal(SCROLL_LEFT, start, stop, 0, (_displayWidth / 2) - 1, SCROLL_2FRAMES);
+}
 
-  Undocumented. Doesn't yet work.
+/** \brief Up scrolling.
+  Set row start to row stop on the OLED to scroll right while moving up one row per step.
 */
 void SSD1320::scrollUp(uint8_t start, uint8_t stop) {
-  if (stop < start) // Stop must be larger or equal to start
-    return;
+  scrollDiagonal(SCROLL_RIGHT, start, stop, 1, SCROLL_5FRAMES);
+}
+
+/** \brief Stop scrolling.
+    Stop the scrolling of graphics on the OLED.
+*/
+void SSD1320::scrollStop(void) {
+  _scrolling = false;
+  command(DEACTIVATESCROLL);
+}
 
-  scrollStop();   // Must disable scrolling before starting to avoid memory corruption
+/** \brief Is the display scrolling.
+    Returns true between starting a scroll and scrollStop() or the next GDRAM write.
+*/
+boolean SSD1320::isScrolling(void) {
+  return _scrolling;
+}
 
-  command(SETVERTICALSCROLLAREA);
-  command(0x00); //Byte A - Set number of rows in top fixed area
-  command(64); //Byte B - Set number of rows in scroll area
+#ifdef SSD1320_ENABLE_STATS
+/** \brief Get frame statistics.
+  Counters since begin() or resetStats(). Divide framesFlushed by the elapsed time for FPS,
+  and totalFlushMicros by totalDrawMicros + totalFlushMicros for bus utilization.
+*/
+const SSD1320_Stats &SSD1320::getStats(void) {
+  return _stats;
+}
 
-  command(VERTICALRIGHTHORIZONTALSCROLL);
-  command(0x00); //Byte A - Dummy byte
-  //command(0x00); //Dummy byte
-  command(start); //Byte B - Define starting page address
+/** \brief Reset frame statistics.
+  Zero all counters. The next frame's draw time is measured from now.
+*/
+void SSD1320::resetStats(void) {
+  memset(&_stats, 0, sizeof(_stats));
+  _stats.flushEnd = micros();
+}
 
-  command(0); //Byte C - Number of rows to scroll. You scan scroll part of the display
+/** \brief Set frame callback.
+  The callback runs at the end of every flush with the updated statistics. It may draw,
+  for example an FPS overlay, which then shows on the next frame. Pass NULL to remove it.
+*/
+void SSD1320::setFrameCallback(SSD1320_FrameCallback callback) {
+  _frameCallback = callback;
+}
 
-  command(stop); //Byte D - Define end page address
-  command(0x01); //Byte E - Vertical scrolling offset
-  command(ACTIVATESCROLL);
+/** \brief Start timing a flush.
+  For code that writes GDRAM itself: call before sending a frame, and endFlush() after, so
+  the frame is counted like a display().
+*/
+void SSD1320::beginFlush(void) {
+  _stats.flushStart = micros();
+  _stats.drawMicros = _stats.flushStart - _stats.flushEnd;
+  _stats.totalDrawMicros += _stats.drawMicros;
 }
-/** \brief Stop scrolling.
-    Stop the scrolling of graphics on the OLED.
+
+/** \brief Finish timing a flush.
+  area is the number of pixels the frame sent. Updates the statistics and runs the frame callback.
 */
-void SSD1320::scrollStop(void) {
-  command(DEACTIVATESCROLL);
+void SSD1320::endFlush(unsigned long area) {
+  _stats.flushEnd = micros();
+  _stats.flushMicros = _stats.flushEnd - _stats.flushStart;
+  _stats.totalFlushMicros += _stats.flushMicros;
+  _stats.dirtyArea = area;
+  _stats.framesFlushed++;
+
+  //Anything the callback draws counts as draw time of the next frame
+  if (_frameCallback != NULL) _frameCallback(_stats);
 }
+#endif
 
 /** \brief Vertical flip.
   Flip the graphics on the OLED vertically.
 */
 void SSD1320::flipVertical(boolean flip) {
   if (flip) {
-    command(COMSCANINC);
+    _comScan = COMSCANINC;
   }
   else {
-    command(COMSCANDEC);
+    _comScan = COMSCANDEC;
   }
+  command(_comScan);
 }
 
 /** \brief Horizontal flip.
@@ -949,9 +2145,39 @@ void SSD1320::flipVertical(boolean flip) {
 */
 void SSD1320::flipHorizontal(boolean flip) {
   if (flip) {
-    command(SETSEGREMAP | 0x01); //Set the bit
+    _segRemap = SETSEGREMAP | 0x01; //Set the bit
   }
   else {
-    command(SETSEGREMAP & ~0x01); //Clear the bit
+    _segRemap = SETSEGREMAP & ~0x01; //Clear the bit
   }
+  command(_segRemap);
+}
+
+/** \brief Set rotation.
+    Rotate the display by 0, 90, 180 or 270 degrees clockwise (rotation 0 to 3).
+    180 degrees is done entirely by the controller's segment and COM remapping.
+    For 90 and 270 degrees the screen buffer is stored transposed (x and y swapped)
+    and the controller's remapping supplies the mirror that turns the transpose into a
+    rotation. Width and height swap, so redraw the screen after changing rotation.
+    This overrides flipVertical() and flipHorizontal().
+*/
+void SSD1320::setRotation(uint8_t rotation) {
+  _rotation = rotation & 0x03;
+
+  _segRemap = SETSEGREMAP;
+  _comScan = COMSCANINC;
+  if (_rotation == 2 || _rotation == 3) _segRemap |= 0x01;
+  if (_rotation == 1 || _rotation == 2) _comScan = COMSCANDEC;
+
+  uint8_t cmds[2];
+  cmds[0] = _segRemap;
+  cmds[1] = _comScan;
+  sendBlock(cmds, 2, SPI3_COMMAND, false);
+}
+
+/** \brief Get rotation.
+    Return the current rotation, 0 to 3.
+*/
+uint8_t SSD1320::getRotation(void) {
+  return _rotation;
 }
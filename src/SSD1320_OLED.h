@@ -7,18 +7,67 @@
   So we bit-bang the first bit then use SPI hardware to send remaining 8 bits
 */
 
+#ifndef SSD1320_OLED_H
+#define SSD1320_OLED_H
+
 #include <Arduino.h>
 #include <SPI.h>
 
+// Uncomment, or pass -DSSD1320_ENABLE_I2C to every file of the build, to drive the display
+// over I2C with SSD1320(Wire, ...). Left out, SPI sketches don't pull in Wire, its buffers and
+// the TWI interrupt, about 200 bytes of RAM on AVR.
+//#define SSD1320_ENABLE_I2C
+
+#ifdef SSD1320_ENABLE_I2C
+#include <Wire.h>
+#endif
+
 #define SCLK_PIN_DEFAULT 13
 #define SDOUT_PIN_DEFAULT 11
 #define CS_PIN_DEFAULT 10
 #define RST_PIN_DEFAULT 8
 
+#define SSD1320_SPI_CLOCK 8000000 // Default for commands and data, see setSPIClock()
+
+#define SSD1320_I2C_ADDRESS 0x3C // SA0 low, 0x3D with SA0 high
+
+// Size of the panel the screen buffer is built for. The flexible OLED is 160x32. Build with
+// -DSSD1320_WIDTH=... -DSSD1320_HEIGHT=... for another SSD1320 panel. Width must be a multiple of 8.
+#ifndef SSD1320_WIDTH
+#define SSD1320_WIDTH  160
+#endif
+#ifndef SSD1320_HEIGHT
+#define SSD1320_HEIGHT 32
+#endif
+
+#define SSD1320_STRIDE     (SSD1320_WIDTH / 8)               // Screen buffer bytes per row
+#define SSD1320_BUFFERSIZE (SSD1320_STRIDE * SSD1320_HEIGHT) // 640 bytes for 160x32
+
 #define swap(a, b) { uint8_t t = a; a = b; b = t; }
 
+// Called once per setPixel(). Empty unless a benchmark defines it before this header.
+#ifndef SSD1320_PIXEL_HOOK
+#define SSD1320_PIXEL_HOOK()
+#endif
+
+// Uncomment, or pass -DSSD1320_ENABLE_STATS to every file of the build, to keep the
+// frame statistics returned by getStats(). Left out, they cost no RAM, flash or time.
+//#define SSD1320_ENABLE_STATS
+
+#ifdef SSD1320_ENABLE_STATS
+#define SSD1320_STAT(code) code
+#else
+#define SSD1320_STAT(code)
+#endif
+
 #define BLACK 0
 #define WHITE 1
+#define GRAY(level) (0x10 | ((level) & 0x0F)) // 4-bit gray, 0 to 15. Drawn as BLACK or WHITE outside displayBanded().
+
+// Rows rendered per pass by displayBanded(). The band takes SSD1320_WIDTH / 2 bytes per row of stack.
+#ifndef SSD1320_BAND_HEIGHT
+#define SSD1320_BAND_HEIGHT 4
+#endif
 
 #define FONTHEADERSIZE    6
 
@@ -29,6 +78,30 @@
 #define CLEAR_DISPLAY     1
 #define CLEAR_BUFFER      2
 
+#define GRAYTABLE_LINEAR  0
+#define GRAYTABLE_GAMMA15 1
+#define GRAYTABLE_GAMMA20 2
+#define GRAYTABLE_GAMMA25 3
+#define GRAYTABLE_CUSTOM  0xFE
+#define GRAYTABLE_DEFAULT 0xFF
+
+#define GRAYTABLE_MAX     0x3F  // Largest GS1-GS15 pulse width the presets use
+
+// Dithering methods, see SSD1320_Dither.h
+#define DITHER_NONE  0
+#define DITHER_BAYER 1
+#define DITHER_FLOYD 2
+
+// Scaling methods, see SSD1320_Scaler.h
+#define SCALE_NEAREST 0
+#define SCALE_BOX     1
+
+#define TRANSITION_NONE     0
+#define TRANSITION_CONTRAST 1
+#define TRANSITION_GRAY     2
+#define TRANSITION_BLINK    3
+#define TRANSITION_PULSE    4
+
 #define MEMORYMODE          0x20
 #define SETCOLUMN           0x21
 #define SETROW              0x22
@@ -57,6 +130,7 @@
 #define SETCOMPINS          0xDA
 #define SETVCOMDESELECT     0xDB
 #define SETCOMMANDLOCK      0xFD
+#define NOP                 0xE3
 
 // Scroll - It's not documented in the SSD1320 doc but we
 // guessed at it from the SSD1306 doc (see MicroOLED product).
@@ -68,6 +142,22 @@
 #define VERTICALRIGHTHORIZONTALSCROLL 0x29
 #define VERTICALLEFTHORIZONTALSCROLL  0x2A
 
+#define SCROLL_RIGHT 0
+#define SCROLL_LEFT  1
+
+// Scroll step interval in frames (byte C of the scroll setup commands)
+#define SCROLL_2FRAMES   0x07
+#define SCROLL_3FRAMES   0x04
+#define SCROLL_4FRAMES   0x05
+#define SCROLL_5FRAMES   0x00
+#define SCROLL_25FRAMES  0x06
+#define SCROLL_64FRAMES  0x01
+#define SCROLL_128FRAMES 0x02
+#define SCROLL_256FRAMES 0x03
+
+// Called by displayBanded() once per band of rows top to top + rows - 1
+typedef void (*SSD1320_BandCallback)(uint8_t top, uint8_t rows);
+
 typedef enum CMD {
   CMD_CLEAR,      //0
   CMD_INVERT,     //1
@@ -87,9 +177,33 @@ typedef enum CMD {
   CMD_GETLCDWIDTH,  //15
   CMD_GETLCDHEIGHT, //16
   CMD_SETCOLOR,   //17
-  CMD_SETDRAWMODE   //18
+  CMD_SETDRAWMODE,  //18
+  CMD_SETFONTTYPE,  //19
+  CMD_PRINT     //20
 } commCommand_t;
 
+#ifdef SSD1320_ENABLE_STATS
+// Counters kept since begin() or resetStats(). Times are micros().
+typedef struct {
+  unsigned long framesFlushed;    // Completed flushes: display(), displayBanded(), sprite flushes
+  unsigned long bytesSent;        // GDRAM data bytes
+  unsigned long commandsSent;     // Command and argument bytes
+  unsigned long dirtyArea;        // Pixels pushed by the last flush
+  unsigned long drawMicros;       // From the end of the previous flush to the start of the last one
+  unsigned long flushMicros;      // Length of the last flush
+  unsigned long totalDrawMicros;
+  unsigned long totalFlushMicros;
+  unsigned long flushStart;       // When the last flush started
+  unsigned long flushEnd;         // When the last flush finished
+} SSD1320_Stats;
+
+typedef void (*SSD1320_FrameCallback)(const SSD1320_Stats &stats);
+#endif
+
+class SSD1320_Dither;
+class SSD1320_ImageReader;
+class SSD1320_Scaler;
+
 class SSD1320 : public Print {
   public:
     SSD1320(uint8_t csPin = CS_PIN_DEFAULT,
@@ -97,24 +211,57 @@ class SSD1320 : public Print {
             uint8_t sclkPin = SCLK_PIN_DEFAULT,
             uint8_t sdoutPin = SDOUT_PIN_DEFAULT,
             SPIClass *spiInterface = &SPI);
-    void begin(uint16_t, uint16_t);
+#ifdef SSD1320_ENABLE_I2C
+    SSD1320(TwoWire &wirePort, uint8_t address = SSD1320_I2C_ADDRESS, uint8_t rstPin = RST_PIN_DEFAULT);
+#endif
+    void begin(uint16_t, uint16_t, uint32_t spiClock = 0);
+    void reinit(void);
+    void setInitSequence(const uint8_t *sequence, uint8_t length);
     virtual size_t write(uint8_t);
 
+    void setDCPin(uint8_t dcPin);
+    void setSPIClock(uint32_t commandClock, uint32_t dataClock = 0);
+#ifdef SSD1320_ENABLE_I2C
+    void setI2CClock(uint32_t clock);
+#endif
+
     // RAW LCD functions
     void command(uint8_t cmd);
     void data(uint8_t d);
+    void writeCommands(const uint8_t *cmds, uint16_t length);
+    void writeData(const uint8_t *data, uint16_t length);
     void setColumnAddress(uint8_t address);
     void setRowAddress(uint8_t address);
+    void setWindow(uint8_t startColumn, uint8_t endColumn, uint8_t startRow, uint8_t endRow);
+    static void expandBits(const uint8_t *bits, uint16_t firstPixel, uint8_t *gdram, uint8_t length);
 
     // LCD Draw functions
     void clearDisplay(uint8_t mode = CLEAR_ALL);
     void display(void);
+    void displayBanded(SSD1320_BandCallback draw);
+    void selfTest(void);
     void setCursor(uint8_t x, uint8_t y);
 
     void invert(boolean inv);
     void setContrast(uint8_t contrast);
+    void setGrayTable(const uint8_t levels[15]);
+    boolean setGrayTablePreset(uint8_t preset);
+    void setDefaultGrayTable(void);
+    uint8_t getGrayTablePreset(void);
+    void setGrayBrightness(uint8_t level);
+
+    // Hardware transitions, advanced by update()
+    void fadeContrast(uint8_t to, uint16_t duration);
+    void fadeGray(uint8_t to, uint16_t duration);
+    void blink(uint16_t period, uint8_t count = 0);
+    void pulse(uint8_t low, uint8_t high, uint16_t period);
+    void stopTransition(void);
+    boolean update(void);
+    boolean isTransitioning(void);
     void flipVertical(boolean flip);
     void flipHorizontal(boolean flip);
+    void setRotation(uint8_t rotation);
+    uint8_t getRotation(void);
 
     void setPixel(uint8_t x, uint8_t y);
     void setPixel(uint8_t x, uint8_t y, uint8_t color, uint8_t mode);
@@ -138,8 +285,19 @@ class SSD1320 : public Print {
 
     void drawChar(uint8_t x, uint8_t y, uint8_t c);
     void drawChar(uint8_t x, uint8_t y, uint8_t c, uint8_t color, uint8_t mode);
+    uint8_t getCharColumn(uint8_t c, uint8_t column, uint8_t row = 0);
+    void drawBits(uint8_t x, uint8_t y, const uint8_t *bits, uint8_t width, uint8_t height,
+                  uint8_t color, uint8_t mode);
 
     void drawBitmap(uint8_t *bitArray);
+    void drawGrayImage(uint8_t x, uint8_t y, uint8_t width, uint8_t height, const uint8_t *image,
+                       uint8_t bitsPerPixel = 4, uint8_t dither = DITHER_FLOYD);
+    boolean drawImage(const uint8_t *image, uint8_t x = 0, uint8_t y = 0);
+    boolean displayImage(const uint8_t *image, uint8_t x = 0, uint8_t y = 0);
+    boolean drawImage(const uint8_t *image, uint8_t x, uint8_t y, uint8_t width, uint8_t height,
+                      uint8_t scaling = SCALE_BOX);
+    boolean displayImage(const uint8_t *image, uint8_t x, uint8_t y, uint8_t width, uint8_t height,
+                         uint8_t scaling = SCALE_BOX);
 
     uint16_t getDisplayWidth(void);
     uint16_t getDisplayHeight(void);
@@ -159,27 +317,97 @@ class SSD1320 : public Print {
     uint8_t getFontTotalChar(void);
 
     // LCD Rotate Scroll functions
+    void scrollHorizontal(uint8_t direction, uint8_t startRow, uint8_t endRow,
+                          uint8_t startColumn, uint8_t endColumn, uint8_t interval);
+    void scrollDiagonal(uint8_t direction, uint8_t startRow, uint8_t endRow,
+                        uint8_t verticalOffset, uint8_t interval);
     void scrollRight(uint8_t start, uint8_t stop);
     void scrollLeft(uint8_t start, uint8_t stop);
-
-    //TODO Add 0x29/0x2A vertical scrolling commands
     void scrollUp(uint8_t start, uint8_t stop);
-    //void scrollVertLeft(uint8_t start, uint8_t stop);
 
     void scrollStop(void);
+    boolean isScrolling(void);
+
+#ifdef SSD1320_ENABLE_STATS
+    // Frame statistics
+    const SSD1320_Stats &getStats(void);
+    void resetStats(void);
+    void setFrameCallback(SSD1320_FrameCallback callback);
+
+    // For code that sends its own frames, like SSD1320_Sprites::flush()
+    void beginFlush(void);
+    void endFlush(unsigned long area);
+#endif
 
   private:
-    uint8_t _sclk, _sd, _cs, _rst;
+    uint8_t _sclk, _sd, _cs, _rst, _dc;
+#if defined(__AVR__)
+    volatile uint8_t *_csPort, *_sclkPort, *_sdPort, *_dcPort;
+    uint8_t _csMask, _sclkMask, _sdMask, _dcMask;
+#endif
     uint8_t _interface;
     SPIClass *_spi;
+    SPISettings _commandSettings, _dataSettings;
+#ifdef SSD1320_ENABLE_I2C
+    TwoWire *_i2c;
+    uint8_t _i2cAddress;
+    uint32_t _i2cClock;
+    uint8_t _i2cPending; //Bytes in the open Wire transmission
+#endif
+    boolean _scrolling;
 
     uint16_t _displayWidth, _displayHeight;
 
     void powerUp();
+    void sendBlock(const uint8_t *buffer, uint16_t length, uint8_t dc, boolean progmem);
+    void startTransfer(uint8_t dc);
+    void transferBlock(const uint8_t *buffer, uint16_t length, uint8_t dc, boolean progmem);
+    void endTransfer(void);
     static const unsigned char *fontsPointer[];
 
+    const uint8_t *_initSequence;
+    uint8_t _initLength;
+
+    //Runtime settings that reinit() must put back on top of the init sequence. 0 = not changed.
+    uint8_t _segRemap, _comScan, _invertCmd;
+    uint8_t _contrast;
+    boolean _contrastSet;
+    uint8_t _grayPreset;
+    uint8_t _grayLevels[15];
+    uint8_t _grayBrightness;
+
+    uint8_t _transType, _transFrom, _transTo, _transCount, _transValue;
+    uint16_t _transDuration;
+    unsigned long _transStart;
+    void startTransition(uint8_t type, uint8_t from, uint8_t to, uint16_t duration);
+
     uint8_t foreColor, drawMode, fontWidth, fontHeight, fontType, fontStartChar, fontTotalChar, cursorX, cursorY;
     uint16_t fontMapWidth;
 
     uint8_t flipByte(uint8_t thing);
+    uint16_t charStart(uint8_t tempC);
+
+#ifdef SSD1320_ENABLE_STATS
+    SSD1320_Stats _stats;
+    SSD1320_FrameCallback _frameCallback;
+#endif
+
+    uint8_t _rotation;
+    static void transpose8x8(uint8_t *block);
+    void blitBlock(uint16_t x, uint16_t y, uint8_t *columns, uint8_t width, uint8_t color, uint8_t mode);
+    void blitRow(uint16_t x, uint16_t y, uint8_t bits, uint8_t width, uint8_t color, uint8_t mode);
+
+    //4bpp band that drawing goes to during displayBanded(), NULL otherwise
+    uint8_t *_band;
+    uint8_t _bandTop, _bandRows;
+    static uint8_t grayLevel(uint8_t color);
+    void bandPixel(uint8_t x, uint8_t y, uint8_t level, uint8_t mode);
+
+    void drawGrayRow(uint8_t x, uint8_t y, const uint8_t *row, uint8_t width, uint8_t bitsPerPixel,
+                     boolean progmem, SSD1320_Dither &dither);
+    void beginScaledImage(SSD1320_ImageReader &reader, SSD1320_Scaler &scaler, uint8_t &x, uint8_t &y,
+                          uint8_t width, uint8_t height);
+    void scaleImageRow(SSD1320_ImageReader &reader, SSD1320_Scaler &scaler, uint8_t *row);
 };
+
+#endif
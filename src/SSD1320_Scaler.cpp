@@ -0,0 +1,181 @@
+/*
+  Streaming image downscaler for the SSD1320 driver. See SSD1320_Scaler.h.
+*/
+
+#include "SSD1320_Scaler.h"
+
+#define SCALER_MAX_ROWS 257 // 257 * 255 still fits the uint16_t column sums
+
+uint16_t SSD1320_Scaler::_sums[SSD1320_WIDTH];
+
+/** \brief Scaler constructor.
+    method is SCALE_NEAREST or SCALE_BOX.
+*/
+SSD1320_Scaler::SSD1320_Scaler(uint8_t method) {
+  _method = method;
+  begin(1, 1, 1, 1);
+}
+
+/** \brief Start an image.
+    Shrink a sourceWidth x sourceHeight image to width x height. Neither side is enlarged.
+*/
+void SSD1320_Scaler::begin(uint16_t sourceWidth, uint16_t sourceHeight, uint8_t width, uint8_t height) {
+  if (sourceWidth == 0) sourceWidth = 1;
+  if (sourceHeight == 0) sourceHeight = 1;
+  if (width > SSD1320_WIDTH) width = SSD1320_WIDTH;
+  if (width == 0) width = 1;
+  if (height == 0) height = 1;
+  if (width > sourceWidth) width = sourceWidth;
+  if (height > sourceHeight) height = sourceHeight;
+
+  _sourceWidth = sourceWidth;
+  _sourceHeight = sourceHeight;
+  _width = width;
+  _height = height;
+
+  _sourceY = 0;
+  _rowError = 0;
+  _rowSample = _sourceHeight; //Center of the first output row, half a step in
+  _rows = 0;
+  _ready = false;
+  memset(_sums, 0, sizeof(_sums));
+  startRow();
+}
+
+/** \brief Add a pixel.
+    The next pixel, 0 to 255, of the current source row.
+*/
+void SSD1320_Scaler::pixel(uint8_t gray) {
+  if (_sourceX >= _sourceWidth) return;
+
+  if (_ready)
+  {
+    //The last output row has been read, start summing the next one
+    if (_method == SCALE_BOX) memset(_sums, 0, sizeof(_sums));
+    _rows = 0;
+    _ready = false;
+  }
+
+  if (_method == SCALE_NEAREST)
+  {
+    //Output columns are 2 * _sourceWidth apart, a source pixel is 2 * _width wide
+    if (_take)
+    {
+      if (_sample < 2 * (uint32_t)_width)
+      {
+        _sums[_column++] = gray;
+        _sample += 2 * (uint32_t)_sourceWidth;
+      }
+      _sample -= 2 * (uint32_t)_width;
+    }
+  }
+  else
+  {
+    _sum += gray;
+    _count++;
+
+    //Column _column covers the source pixels where x * width / sourceWidth == _column
+    _columnError += _width;
+    if (_columnError >= _sourceWidth)
+    {
+      _columnError -= _sourceWidth;
+      if (_rows < SCALER_MAX_ROWS) _sums[_column] += (_sum + _count / 2) / _count;
+      _column++;
+      _sum = 0;
+      _count = 0;
+    }
+  }
+  _sourceX++;
+}
+
+/** \brief End a source row.
+    Returns true when an output row is ready for get().
+*/
+boolean SSD1320_Scaler::endRow(void) {
+  boolean ready = false;
+
+  if (_sourceY < _sourceHeight)
+  {
+    if (_method == SCALE_NEAREST)
+    {
+      if (_take)
+      {
+        _rowSample += 2 * (uint32_t)_sourceHeight;
+        ready = true;
+      }
+      _rowSample -= 2 * (uint32_t)_height;
+    }
+    else
+    {
+      if (_rows < SCALER_MAX_ROWS) _rows++;
+      _rowError += _height;
+      if (_rowError >= _sourceHeight)
+      {
+        _rowError -= _sourceHeight;
+        ready = true;
+      }
+    }
+    _sourceY++;
+  }
+
+  _ready = ready;
+  startRow();
+  return ready;
+}
+
+/** \brief Output pixel.
+    Pixel x, 0 to 255, of the output row endRow() just finished.
+*/
+uint8_t SSD1320_Scaler::get(uint8_t x) {
+  if (x >= _width) return 0;
+  if (_method == SCALE_NEAREST) return _sums[x];
+  return (_sums[x] + _rows / 2) / _rows;
+}
+
+/** \brief Output width.
+    Width in pixels after begin() has cut it to the source.
+*/
+uint8_t SSD1320_Scaler::getWidth(void) {
+  return _width;
+}
+
+/** \brief Output height.
+    Height in pixels after begin() has cut it to the source.
+*/
+uint8_t SSD1320_Scaler::getHeight(void) {
+  return _height;
+}
+
+/** \brief Fit an image into a box.
+    width and height give the box and are set to the biggest size of the same shape as the
+    source that fits in it. An image that already fits keeps its size.
+*/
+void SSD1320_Scaler::fit(uint16_t sourceWidth, uint16_t sourceHeight, uint8_t &width, uint8_t &height) {
+  if (sourceWidth == 0 || sourceHeight == 0) return;
+  if (sourceWidth <= width && sourceHeight <= height)
+  {
+    width = sourceWidth;
+    height = sourceHeight;
+  }
+  else if ((uint32_t)sourceWidth * height > (uint32_t)sourceHeight * width)
+  {
+    uint32_t scaled = (uint32_t)sourceHeight * width / sourceWidth;
+    height = (scaled > 0) ? scaled : 1;
+  }
+  else
+  {
+    uint32_t scaled = (uint32_t)sourceWidth * height / sourceHeight;
+    width = (scaled > 0) ? scaled : 1;
+  }
+}
+
+// Get ready for the next source row
+void SSD1320_Scaler::startRow(void) {
+  _sourceX = 0;
+  _column = 0;
+  _columnError = 0;
+  _sample = _sourceWidth; //Center of the first output column, half a step in
+  _sum = 0;
+  _count = 0;
+  _take = (_method == SCALE_NEAREST) && _rowSample < 2 * (uint32_t)_height;
+}
@@ -0,0 +1,77 @@
+/*
+  Streaming image downscaler for the SSD1320 driver.
+
+  Shrinks a gray image of any size to at most SSD1320_WIDTH x 255 pixels as it streams
+  past, one source row at a time, so the source never has to be held in RAM. Used by
+  SSD1320_BMP::drawScaled(), SSD1320::drawImage() and SSD1320::displayImage(), and
+  usable on its own.
+
+  SCALE_NEAREST  Each output pixel is the source pixel under its center, the later one
+                 when the center falls between two. Stepped exactly with integer error
+                 terms; this replaced a 16.16 fixed point step, whose truncation could
+                 pick the pixel before the center. No division after begin(). Fast,
+                 keeps edges hard, thin lines may drop out.
+  SCALE_BOX      Each output pixel is the average of the source pixels it covers. The
+                 spans are found with integer steps. There is one division each time a
+                 span of a row closes, once per output column per source row, and one
+                 for each get(), none for the other pixels. Smooth, good for photos and
+                 for shrinking 1-bit art into gray.
+
+  Call begin(), then for each source row, top to bottom or bottom to top, pixel() for
+  every pixel left to right and endRow(). When endRow() returns true an output row is
+  ready: read it with get() before the next pixel(). Images are only shrunk: an output
+  size bigger than the source is cut to the source size. The box filter averages at most
+  257 source rows into an output row, further rows of a taller span are skipped.
+
+  The accumulation buffer is a static 2 * SSD1320_WIDTH bytes shared by every scaler, like
+  the screen buffer, so a scaler costs little stack. Only one image can be scaled at a
+  time: constructing or starting a scaler clears the buffer of any other.
+*/
+
+#ifndef SSD1320_SCALER_H
+#define SSD1320_SCALER_H
+
+#include "SSD1320_OLED.h"
+
+class SSD1320_Scaler {
+  public:
+    SSD1320_Scaler(uint8_t method = SCALE_BOX);
+
+    void begin(uint16_t sourceWidth, uint16_t sourceHeight, uint8_t width, uint8_t height);
+    void pixel(uint8_t gray);
+    boolean endRow(void);
+    uint8_t get(uint8_t x);
+
+    uint8_t getWidth(void);
+    uint8_t getHeight(void);
+
+    static void fit(uint16_t sourceWidth, uint16_t sourceHeight, uint8_t &width, uint8_t &height);
+
+  private:
+    uint8_t _method;
+    uint16_t _sourceWidth, _sourceHeight;
+    uint8_t _width, _height;
+
+    static uint16_t _sums[SSD1320_WIDTH]; // Box: column sums of the rows so far. Nearest: the row.
+
+    // Along the row
+    uint8_t _column;         // Output column being filled
+    uint16_t _columnError;   // Box: integer step toward the next column
+    uint32_t _sample;        // Nearest: next output column's center past this pixel's left edge,
+                             // in 1 / (2 * _width) pixels
+    uint16_t _sourceX;
+    uint32_t _sum;           // Box: sum of the current column's pixels in this row
+    uint16_t _count;
+
+    // Down the image
+    uint16_t _rowError;
+    uint32_t _rowSample;     // Nearest: the same for rows, in 1 / (2 * _height) rows
+    uint16_t _sourceY;
+    uint16_t _rows;          // Box: source rows summed into _sums
+    boolean _ready;          // An output row is waiting in _sums
+    boolean _take;           // Nearest: this source row is the output row
+
+    void startRow(void);
+};
+
+#endif
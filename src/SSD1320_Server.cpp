@@ -0,0 +1,211 @@
+/*
+  Remote control of an SSD1320 over any Stream. See SSD1320_Server.h for the protocol.
+*/
+
+#include "SSD1320_Server.h"
+
+// Frame parser states
+#define STATE_SYNC     0
+#define STATE_SEQUENCE 1
+#define STATE_LENGTH   2
+#define STATE_PAYLOAD  3
+#define STATE_CRC      4
+
+/** \brief Server constructor.
+    Draw what arrives on port onto oled. Call begin() on both first.
+*/
+SSD1320_Server::SSD1320_Server(SSD1320 &oled, Stream &port) {
+  _oled = &oled;
+  _port = &port;
+  _state = STATE_SYNC;
+  _lastByte = 0;
+  _replied = false;
+  _frames = 0;
+  _errors = 0;
+}
+
+/** \brief Handle incoming bytes.
+    Read whatever is waiting on the port, draw each complete frame and reply to it.
+    Call this often from loop(). Returns the number of frames drawn.
+*/
+uint8_t SSD1320_Server::update(void) {
+  uint8_t drawn = 0;
+
+  //Drop a frame that stopped arriving part way through
+  if (_state != STATE_SYNC && millis() - _lastByte > SERVER_TIMEOUT)
+  {
+    _state = STATE_SYNC;
+    _errors++;
+  }
+
+  while (_port->available() > 0)
+  {
+    uint8_t c = _port->read();
+    _lastByte = millis();
+
+    switch (_state)
+    {
+      case STATE_SYNC:
+        if (c == SERVER_SYNC) _state = STATE_SEQUENCE;
+        break;
+
+      case STATE_SEQUENCE:
+        _sequence = c;
+        _crc = crc8(0, c);
+        _state = STATE_LENGTH;
+        break;
+
+      case STATE_LENGTH:
+        _length = c;
+        _count = 0;
+        _crc = crc8(_crc, c);
+        _state = (_length > 0) ? STATE_PAYLOAD : STATE_CRC;
+        break;
+
+      case STATE_PAYLOAD:
+        if (_count < SSD1320_SERVER_BUFFER) _payload[_count] = c; //Too long frames are NAKed below
+        _count++;
+        _crc = crc8(_crc, c);
+        if (_count == _length) _state = STATE_CRC;
+        break;
+
+      case STATE_CRC:
+        _state = STATE_SYNC;
+
+        if (c != _crc || _length > SSD1320_SERVER_BUFFER)
+        {
+          _errors++;
+          _replySequence = _sequence;
+          _replyStatus = SERVER_NAK;
+          _replyLength = 0;
+          _replied = false; //A resend of this sequence number must be drawn
+        }
+        else if (_replied && _sequence == _replySequence)
+        {
+          //Our reply got lost and the host sent the frame again. It has already been drawn.
+        }
+        else
+        {
+          _replySequence = _sequence;
+          _replyStatus = apply() ? SERVER_ACK : SERVER_NAK;
+          _replied = (_replyStatus == SERVER_ACK);
+          if (_replied)
+          {
+            _frames++;
+            drawn++;
+          }
+          else
+            _errors++;
+        }
+        sendReply();
+        break;
+    }
+  }
+
+  return drawn;
+}
+
+/** \brief Frames drawn.
+    Frames drawn since the server was created.
+*/
+unsigned long SSD1320_Server::getFrames(void) {
+  return _frames;
+}
+
+/** \brief Frame errors.
+    Damaged, too long, timed out or invalid frames since the server was created.
+*/
+unsigned long SSD1320_Server::getErrors(void) {
+  return _errors;
+}
+
+/** \brief CRC-8.
+    Add data to crc, polynomial 0x07 with no reflection. Start from 0.
+    The host must compute the same to build frames.
+*/
+uint8_t SSD1320_Server::crc8(uint8_t crc, uint8_t data) {
+  crc ^= data;
+  for (uint8_t bit = 0 ; bit < 8 ; bit++)
+    crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : (crc << 1);
+  return crc;
+}
+
+// Bytes taken by the command at the start of command, 0 if invalid or cut short
+uint16_t SSD1320_Server::commandLength(const uint8_t *command, uint16_t length) {
+  if (length == 0) return 0;
+
+  if (command[0] == CMD_GETLCDWIDTH || command[0] == CMD_GETLCDHEIGHT)
+    return 1;
+
+  if (command[0] == CMD_DRAWBITMAP)
+  {
+    if (length < 5) return 0;
+    uint16_t used = 5 + (uint16_t)command[3] * command[4];
+    return (used <= length) ? used : 0;
+  }
+
+  return SSD1320_DisplayList::commandLength(command, length);
+}
+
+// Check the whole batch, then draw it. Nothing is drawn if any command is bad.
+boolean SSD1320_Server::apply(void) {
+  uint16_t spot = 0;
+  while (spot < _length)
+  {
+    uint16_t used = commandLength(_payload + spot, _length - spot);
+    if (used == 0) return false;
+    spot += used;
+  }
+
+  _replyLength = 0;
+  spot = 0;
+  while (spot < _length)
+  {
+    const uint8_t *command = _payload + spot;
+    spot += commandLength(command, _length - spot);
+
+    if (command[0] == CMD_GETLCDWIDTH || command[0] == CMD_GETLCDHEIGHT)
+    {
+      uint16_t size = (command[0] == CMD_GETLCDWIDTH) ? _oled->getDisplayWidth() : _oled->getDisplayHeight();
+      if (_replyLength + 2 <= SERVER_REPLY_DATA)
+      {
+        _replyData[_replyLength++] = size & 0xFF;
+        _replyData[_replyLength++] = size >> 8;
+      }
+    }
+    else if (command[0] == CMD_DRAWBITMAP)
+    {
+      uint8_t column = command[1], y = command[2], width = command[3], height = command[4];
+      const uint8_t *bits = command + 5;
+      uint8_t *screen = _oled->getScreenBuffer();
+
+      for (uint8_t row = 0 ; row < height ; row++)
+        for (uint8_t x = 0 ; x < width ; x++)
+          if (y + row < SSD1320_HEIGHT && column + x < SSD1320_STRIDE)
+            screen[(y + row) * SSD1320_STRIDE + column + x] = bits[row * width + x];
+    }
+    else
+      SSD1320_DisplayList::execute(*_oled, command, _length - (command - _payload));
+  }
+  return true;
+}
+
+// Send the reply for the last frame
+void SSD1320_Server::sendReply(void) {
+  uint8_t frame[4 + SERVER_REPLY_DATA + 1];
+  uint8_t spot = 0;
+
+  frame[spot++] = SERVER_SYNC;
+  frame[spot++] = _replySequence;
+  frame[spot++] = _replyStatus;
+  frame[spot++] = (_replyStatus == SERVER_ACK) ? _replyLength : 0;
+  for (uint8_t x = 0 ; x < frame[3] ; x++)
+    frame[spot++] = _replyData[x];
+
+  uint8_t crc = 0;
+  for (uint8_t x = 1 ; x < spot ; x++)
+    crc = crc8(crc, frame[x]);
+  frame[spot++] = crc;
+
+  _port->write(frame, spot);
+}
@@ -0,0 +1,71 @@
+/*
+  Remote control of an SSD1320 over any Stream: Serial, SoftwareSerial, a radio link...
+
+  The host sends frames:
+    SERVER_SYNC, sequence, length, payload[length], crc
+  The payload is a batch of commands in display list format (see SSD1320_DisplayList.h)
+  plus these, which only the server understands:
+    CMD_DRAWBITMAP    column, y, width, height, then width * height bytes
+                      Copy a block into the 1bpp screen buffer. column and width count
+                      bytes of 8 pixels (MSB on the left), y and height count rows.
+    CMD_GETLCDWIDTH   Add the display width to the reply, 2 bytes LSB first
+    CMD_GETLCDHEIGHT  Add the display height to the reply
+  crc is a CRC-8 (polynomial 0x07) of sequence, length and the payload.
+
+  Every frame gets a reply:
+    SERVER_SYNC, sequence, status, length, data[length], crc
+  status is SERVER_ACK once the whole batch has been drawn, or SERVER_NAK if the frame
+  was damaged, too long for the buffer or held a command the server doesn't know. A NAKed
+  frame is not drawn at all. Wait for the reply before sending the next frame: the reply
+  is the flow control. A frame with the same sequence number as the last one is answered
+  again without being drawn twice, so the host can resend when a reply goes missing.
+*/
+
+#ifndef SSD1320_SERVER_H
+#define SSD1320_SERVER_H
+
+#include "SSD1320_OLED.h"
+#include "SSD1320_DisplayList.h"
+
+#define SERVER_SYNC 0xA5
+#define SERVER_ACK  0x06
+#define SERVER_NAK  0x15
+
+// Largest payload a frame can carry. Costs this many bytes of RAM.
+#ifndef SSD1320_SERVER_BUFFER
+#define SSD1320_SERVER_BUFFER 64
+#endif
+
+#define SERVER_TIMEOUT    100 // ms between bytes before a partial frame is dropped
+#define SERVER_REPLY_DATA 8   // Most reply data bytes, further queries in a batch are ignored
+
+class SSD1320_Server {
+  public:
+    SSD1320_Server(SSD1320 &oled, Stream &port);
+
+    uint8_t update(void);
+    unsigned long getFrames(void);
+    unsigned long getErrors(void);
+
+    static uint8_t crc8(uint8_t crc, uint8_t data);
+
+  private:
+    SSD1320 *_oled;
+    Stream *_port;
+
+    uint8_t _payload[SSD1320_SERVER_BUFFER];
+    uint8_t _state, _sequence, _length, _count, _crc;
+    unsigned long _lastByte;
+
+    boolean _replied;
+    uint8_t _replySequence, _replyStatus, _replyLength;
+    uint8_t _replyData[SERVER_REPLY_DATA];
+
+    unsigned long _frames, _errors;
+
+    uint16_t commandLength(const uint8_t *command, uint16_t length);
+    boolean apply(void);
+    void sendReply(void);
+};
+
+#endif
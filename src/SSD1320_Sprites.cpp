@@ -0,0 +1,332 @@
+/*
+  Sprite layer for the SSD1320 driver. See SSD1320_Sprites.h.
+*/
+
+#include "SSD1320_Sprites.h"
+
+// Image header fields
+#define spriteFormat(image) pgm_read_byte((image))
+#define spriteWidth(image)  pgm_read_byte((image) + 1)
+#define spriteHeight(image) pgm_read_byte((image) + 2)
+
+/** \brief Sprite layer constructor.
+    Sprites are drawn onto oled over its screen buffer.
+*/
+SSD1320_Sprites::SSD1320_Sprites(SSD1320 &oled) {
+  _oled = &oled;
+  for (uint8_t i = 0 ; i < SSD1320_SPRITE_COUNT ; i++)
+  {
+    _sprites[i].image = NULL;
+    _sprites[i].changed = false;
+    _sprites[i].shownWidth = 0;
+    _order[i] = i;
+  }
+  _dirtyCount = 0;
+}
+
+/** \brief Add a sprite.
+    Show image with its bottom left corner at x,y. image is an uncompressed PROGMEM image,
+    1 or 4 bits per pixel. Returns the sprite's number, or SPRITE_NONE if all
+    SSD1320_SPRITE_COUNT are in use or image is compressed or not valid.
+*/
+int8_t SSD1320_Sprites::add(const uint8_t *image, int16_t x, int16_t y, uint8_t z) {
+  SSD1320_ImageReader reader(image);
+  if (!reader.isValid() || (spriteFormat(image) & IMAGE_PACKBITS)) return SPRITE_NONE;
+
+  for (uint8_t i = 0 ; i < SSD1320_SPRITE_COUNT ; i++)
+  {
+    sprite_t *sprite = &_sprites[i];
+    if (sprite->image != NULL) continue;
+
+    //shownX and friends are kept: a sprite removed before the last flush still gets erased
+    sprite->image = image;
+    sprite->x = x;
+    sprite->y = y;
+    sprite->z = z;
+    sprite->visible = true;
+    sprite->changed = true;
+    return i;
+  }
+  return SPRITE_NONE;
+}
+
+/** \brief Remove a sprite.
+    It disappears at the next flush() and its number can be used by add() again.
+*/
+void SSD1320_Sprites::remove(int8_t sprite) {
+  if (!valid(sprite)) return;
+  _sprites[sprite].image = NULL;
+  _sprites[sprite].changed = true;
+}
+
+/** \brief Move a sprite.
+    Put its bottom left corner at x,y. Parts off the display are clipped.
+*/
+void SSD1320_Sprites::moveTo(int8_t sprite, int16_t x, int16_t y) {
+  if (!valid(sprite)) return;
+  if (_sprites[sprite].x == x && _sprites[sprite].y == y) return;
+  _sprites[sprite].x = x;
+  _sprites[sprite].y = y;
+  changed(sprite);
+}
+
+/** \brief Change a sprite's image.
+    For animation. Compressed or invalid images are ignored.
+*/
+void SSD1320_Sprites::setImage(int8_t sprite, const uint8_t *image) {
+  if (!valid(sprite) || _sprites[sprite].image == image) return;
+  SSD1320_ImageReader reader(image);
+  if (!reader.isValid() || (spriteFormat(image) & IMAGE_PACKBITS)) return;
+  _sprites[sprite].image = image;
+  changed(sprite);
+}
+
+/** \brief Show or hide a sprite.
+    A hidden sprite keeps its place in the pool.
+*/
+void SSD1320_Sprites::setVisible(int8_t sprite, boolean visible) {
+  if (!valid(sprite) || _sprites[sprite].visible == visible) return;
+  _sprites[sprite].visible = visible;
+  changed(sprite);
+}
+
+/** \brief Set a sprite's z order.
+    Higher z is drawn on top.
+*/
+void SSD1320_Sprites::setZ(int8_t sprite, uint8_t z) {
+  if (!valid(sprite) || _sprites[sprite].z == z) return;
+  _sprites[sprite].z = z;
+  changed(sprite);
+}
+
+/** \brief Sprite x.
+    Left edge of the sprite.
+*/
+int16_t SSD1320_Sprites::getX(int8_t sprite) {
+  return valid(sprite) ? _sprites[sprite].x : 0;
+}
+
+/** \brief Sprite y.
+    Bottom edge of the sprite.
+*/
+int16_t SSD1320_Sprites::getY(int8_t sprite) {
+  return valid(sprite) ? _sprites[sprite].y : 0;
+}
+
+/** \brief Mark part of the background as changed.
+    The next flush() sends the width x height area at x,y from the screen buffer, with the
+    sprites on top. Call after drawing into the screen buffer.
+*/
+void SSD1320_Sprites::invalidate(int16_t x, int16_t y, uint8_t width, uint8_t height) {
+  addDirty(x, y, x + width, y + height);
+}
+
+/** \brief Send the changes.
+    Compose and send every area that changed since the last flush(). Nothing is sent if
+    nothing changed. With SSD1320_ENABLE_STATS each flush with changes counts as a frame,
+    dirtyArea being the pixels sent.
+*/
+void SSD1320_Sprites::flush(void) {
+  //Old and new place of everything that changed
+  for (uint8_t i = 0 ; i < SSD1320_SPRITE_COUNT ; i++)
+  {
+    sprite_t *sprite = &_sprites[i];
+    if (!sprite->changed) continue;
+    sprite->changed = false;
+
+    if (sprite->shownWidth > 0)
+      addDirty(sprite->shownX, sprite->shownY, sprite->shownX + sprite->shownWidth, sprite->shownY + sprite->shownHeight);
+
+    sprite->shownWidth = 0;
+    if (sprite->image != NULL && sprite->visible)
+    {
+      sprite->shownX = sprite->x;
+      sprite->shownY = sprite->y;
+      sprite->shownWidth = spriteWidth(sprite->image);
+      sprite->shownHeight = spriteHeight(sprite->image);
+      addDirty(sprite->x, sprite->y, sprite->x + sprite->shownWidth, sprite->y + sprite->shownHeight);
+    }
+  }
+
+  if (_dirtyCount == 0) return;
+  SSD1320_STAT(_oled->beginFlush());
+
+  //Merge rectangles that cost less together than apart
+  for (uint8_t i = 0 ; i < _dirtyCount ; i++)
+  {
+    for (uint8_t j = i + 1 ; j < _dirtyCount ; j++)
+    {
+      rect_t both = _dirty[i];
+      grow(both, _dirty[j]);
+      if (area(both) > area(_dirty[i]) + area(_dirty[j]) + SPRITE_MERGE_SLACK) continue;
+
+      _dirty[i] = both;
+      _dirty[j] = _dirty[--_dirtyCount];
+      j = i; //a grew, check it against the rest again
+    }
+  }
+
+  sortByZ();
+
+  SSD1320_STAT(unsigned long sent = 0);
+  for (uint8_t i = 0 ; i < _dirtyCount ; i++)
+  {
+    //Clip to the display and widen to whole GDRAM bytes
+    rect_t &box = _dirty[i];
+    if (box.left < 0) box.left = 0;
+    if (box.bottom < 0) box.bottom = 0;
+    if (box.right > SSD1320_WIDTH) box.right = SSD1320_WIDTH;
+    if (box.top > SSD1320_HEIGHT) box.top = SSD1320_HEIGHT;
+    box.left &= ~1;
+    box.right = (box.right + 1) & ~1;
+    if (box.left < box.right && box.bottom < box.top)
+    {
+      send(box);
+      SSD1320_STAT(sent += area(box));
+    }
+  }
+  _dirtyCount = 0;
+
+  //Counted as a frame, with its callback, like a display()
+  SSD1320_STAT(_oled->endFlush(sent));
+}
+
+/** \brief Send everything.
+    Compose and send the whole display. Use instead of display() while sprites are up.
+*/
+void SSD1320_Sprites::redraw(void) {
+  _dirtyCount = 0;
+  invalidate(0, 0, SSD1320_WIDTH, SSD1320_HEIGHT);
+  flush();
+}
+
+boolean SSD1320_Sprites::valid(int8_t sprite) {
+  return (sprite >= 0) && (sprite < SSD1320_SPRITE_COUNT) && (_sprites[sprite].image != NULL);
+}
+
+void SSD1320_Sprites::changed(int8_t sprite) {
+  _sprites[sprite].changed = true;
+}
+
+void SSD1320_Sprites::addDirty(int16_t left, int16_t bottom, int16_t right, int16_t top) {
+  if (left >= right || bottom >= top) return;
+
+  rect_t added;
+  added.left = left;
+  added.bottom = bottom;
+  added.right = right;
+  added.top = top;
+
+  if (_dirtyCount < SPRITE_DIRTY_COUNT)
+  {
+    _dirty[_dirtyCount++] = added;
+    return;
+  }
+
+  //Full, grow the rectangle that grows least
+  uint8_t best = 0;
+  int32_t bestGrowth = 0x7FFFFFFF;
+  for (uint8_t i = 0 ; i < _dirtyCount ; i++)
+  {
+    rect_t grown = _dirty[i];
+    grow(grown, added);
+    if (area(grown) - area(_dirty[i]) < bestGrowth)
+    {
+      bestGrowth = area(grown) - area(_dirty[i]);
+      best = i;
+    }
+  }
+  grow(_dirty[best], added);
+}
+
+// Grow r to cover other too
+void SSD1320_Sprites::grow(rect_t &r, const rect_t &other) {
+  if (other.left < r.left) r.left = other.left;
+  if (other.bottom < r.bottom) r.bottom = other.bottom;
+  if (other.right > r.right) r.right = other.right;
+  if (other.top > r.top) r.top = other.top;
+}
+
+int32_t SSD1320_Sprites::area(const rect_t &r) {
+  return (int32_t)(r.right - r.left) * (r.top - r.bottom);
+}
+
+// Order the sprites by z for drawing, keeping the pool order for equal z
+void SSD1320_Sprites::sortByZ(void) {
+  for (uint8_t i = 0 ; i < SSD1320_SPRITE_COUNT ; i++) _order[i] = i;
+
+  for (uint8_t i = 1 ; i < SSD1320_SPRITE_COUNT ; i++)
+  {
+    uint8_t sprite = _order[i];
+    uint8_t j = i;
+    while (j > 0 && _sprites[_order[j - 1]].z > _sprites[sprite].z)
+    {
+      _order[j] = _order[j - 1];
+      j--;
+    }
+    _order[j] = sprite;
+  }
+}
+
+// Compose one area, background then sprites, and send it. left and right are even.
+void SSD1320_Sprites::send(rect_t &box) {
+  uint8_t columns = (box.right - box.left) / 2;
+
+  _oled->setWindow(box.left / 2, box.left / 2 + columns - 1, box.bottom, box.top - 1);
+
+  //Whole rows are gathered so a small area goes out in one transfer
+  uint8_t buffer[SSD1320_WIDTH];
+  uint8_t used = 0;
+  uint8_t *screen = _oled->getScreenBuffer();
+
+  for (int16_t y = box.bottom ; y < box.top ; y++)
+  {
+    uint8_t *row = buffer + used;
+
+    //Background, 1 = 0x0F like display()
+    SSD1320::expandBits(screen + y * SSD1320_STRIDE, box.left, row, columns);
+
+    for (uint8_t i = 0 ; i < SSD1320_SPRITE_COUNT ; i++)
+    {
+      sprite_t *sprite = &_sprites[_order[i]];
+      if (sprite->image == NULL || !sprite->visible) continue;
+
+      const uint8_t *image = sprite->image;
+      uint8_t width = spriteWidth(image);
+      if (y < sprite->y || y >= sprite->y + spriteHeight(image)) continue;
+      int16_t from = (sprite->x > box.left) ? sprite->x : box.left;
+      int16_t to = (sprite->x + width < box.right) ? sprite->x + width : box.right;
+      if (from >= to) continue;
+
+      boolean gray = (spriteFormat(image) == IMAGE_4BPP);
+      uint8_t stride = gray ? (width + 1) / 2 : (width + 7) / 8;
+      const uint8_t *data = image + IMAGE_HEADERSIZE + (y - sprite->y) * stride;
+
+      for (int16_t x = from ; x < to ; x++)
+      {
+        uint8_t column = x - sprite->x;
+        uint8_t level;
+        if (gray)
+        {
+          uint8_t pair = pgm_read_byte(data + column / 2);
+          level = (column & 1) ? (pair >> 4) : (pair & 0x0F);
+        }
+        else
+          level = (pgm_read_byte(data + column / 8) & (0x80 >> (column % 8))) ? 0x0F : 0;
+        if (level == 0) continue; //See-through
+
+        //The low nibble is the left pixel
+        uint8_t *pair = row + (x - box.left) / 2;
+        if (x & 1) *pair = (*pair & 0x0F) | (level << 4);
+        else *pair = (*pair & 0xF0) | level;
+      }
+    }
+
+    used += columns;
+    if (used + columns > sizeof(buffer) || y == box.top - 1)
+    {
+      _oled->writeData(buffer, used);
+      used = 0;
+    }
+  }
+}
@@ -0,0 +1,86 @@
+/*
+  Sprite layer for the SSD1320 driver.
+
+  A fixed pool of SSD1320_SPRITE_COUNT sprites drawn over the screen buffer. Each sprite
+  shows an uncompressed image (see SSD1320_Image.h, made with ssd1320_image.py --raw) at
+  a position, can be hidden, and has a z order: higher z is drawn on top, equal z in the
+  order the sprites were added. Pixels that are 0 are see-through, so 1-bit sprites draw
+  their set pixels white and 4-bit ones all but level 0 in gray.
+
+  Sprites are never drawn into the screen buffer. flush() works out the rectangles that
+  changed since the last flush, the old and new place of every sprite that moved, changed
+  or was hidden, merges those that overlap, and for each one composes the screen buffer
+  and the sprites on top of it and sends just that window. The screen buffer is the
+  save-under: what was under a sprite is simply composed again. Moving a 4x4 sprite one
+  pixel sends a 6x5 window.
+
+  Draw the background into the screen buffer and display() it once. After changing the
+  background later, invalidate() the changed part so the next flush() sends it with the
+  sprites on top, or call redraw() instead of display(). x,y are screen buffer coordinates
+  (the bottom left corner of the image, like rectFill()); setRotation() is not used.
+*/
+
+#ifndef SSD1320_SPRITES_H
+#define SSD1320_SPRITES_H
+
+#include "SSD1320_OLED.h"
+#include "SSD1320_Image.h"
+
+// Size of the sprite pool. Each sprite costs 15 bytes of RAM.
+#ifndef SSD1320_SPRITE_COUNT
+#define SSD1320_SPRITE_COUNT 8
+#endif
+
+#define SPRITE_NONE        -1 // add() had no free sprite or the image can't be a sprite
+#define SPRITE_DIRTY_COUNT (SSD1320_SPRITE_COUNT * 2 + 2) // Rectangles a flush can track
+#define SPRITE_MERGE_SLACK 64 // Pixels worth sending twice rather than opening another window
+
+class SSD1320_Sprites {
+  public:
+    SSD1320_Sprites(SSD1320 &oled);
+
+    int8_t add(const uint8_t *image, int16_t x, int16_t y, uint8_t z = 0);
+    void remove(int8_t sprite);
+    void moveTo(int8_t sprite, int16_t x, int16_t y);
+    void setImage(int8_t sprite, const uint8_t *image);
+    void setVisible(int8_t sprite, boolean visible);
+    void setZ(int8_t sprite, uint8_t z);
+
+    int16_t getX(int8_t sprite);
+    int16_t getY(int8_t sprite);
+
+    void invalidate(int16_t x, int16_t y, uint8_t width, uint8_t height);
+    void flush(void);
+    void redraw(void);
+
+  private:
+    typedef struct {
+      const uint8_t *image;     // NULL when the sprite is free
+      int16_t x, y;
+      uint8_t z;
+      boolean visible;
+      boolean changed;          // Moved, hidden, shown or given another image since the last flush
+      int16_t shownX, shownY;   // Where the last flush put it
+      uint8_t shownWidth, shownHeight; // 0 when it isn't on screen
+    } sprite_t;
+
+    typedef struct {
+      int16_t left, bottom, right, top; // right and top are one past the edge
+    } rect_t;
+
+    SSD1320 *_oled;
+    sprite_t _sprites[SSD1320_SPRITE_COUNT];
+    uint8_t _order[SSD1320_SPRITE_COUNT]; // Sprite numbers, lowest z first
+    rect_t _dirty[SPRITE_DIRTY_COUNT];
+    uint8_t _dirtyCount;
+
+    boolean valid(int8_t sprite);
+    void changed(int8_t sprite);
+    void addDirty(int16_t left, int16_t bottom, int16_t right, int16_t top);
+    void sortByZ(void);
+    void send(rect_t &box);
+    static void grow(rect_t &r, const rect_t &other);
+    static int32_t area(const rect_t &r);
+};
+
+#endif